@@ -56,7 +56,7 @@ extern "C" bool32_t init( demo::state_t* pState, demo::input_t* pInput ) {
 
     // Initialize Input //
 
-    std::memset( pInput, 0, sizeof(demo::input_t) );
+    std::memset( pInput, 0, demo::input_t::FRAME_BYTES );
 
     // Initialize Per-Mode Variables //
 
@@ -0,0 +1,5 @@
+################################################################################
+### user config ################################################################
+################################################################################
+
+set(LLCE_INPUT_MOUSE OFF CACHE BOOL "Enable mouse input for the simulation.")
@@ -52,7 +52,16 @@ extern "C" bool32_t boot( hmp::output_t* pOutput ) {
         llce::box_t(0.0f, 0.85f, 1.0f, 0.15f)
     }};
 
-    llce::output::boot<3, 1>( *pOutput, cGFXBuffRes, cGFXBuffBoxs );
+    // NOTE(JRC): Only the game board has diagonal edges (e.g. the ball's velocity
+    // vector), so it's the only buffer that's multisampled; the opaque scoreboard
+    // doesn't need an alpha channel, so it's stored at half the bits per pixel.
+    llce::gfx::format_t cGFXMasterFormat, cGFXSimFormat, cGFXUIFormat;
+    cGFXSimFormat.mSamples = 4;
+    cGFXUIFormat.mPixel = llce::gfx::pixel::rgb565;
+    const std::array<llce::gfx::format_t, 3> cGFXBuffFormats{{
+        cGFXMasterFormat, cGFXSimFormat, cGFXUIFormat }};
+
+    llce::output::boot<3, 1>( *pOutput, cGFXBuffRes, cGFXBuffBoxs, cGFXBuffFormats );
 
     // Initialize Sound //
 
@@ -76,7 +85,7 @@ extern "C" bool32_t init( hmp::state_t* pState, hmp::input_t* pInput ) {
 
     // Initialize Input //
 
-    std::memset( pInput, 0, sizeof(hmp::input_t) );
+    std::memset( pInput, 0, hmp::input_t::FRAME_BYTES );
 
     uint32_t defaultBindings[hmp::action::_length + 1]; {
         defaultBindings[hmp::action::lup] = stream_t( device_e::keyboard, SDL_SCANCODE_W );
@@ -90,7 +99,7 @@ extern "C" bool32_t init( hmp::state_t* pState, hmp::input_t* pInput ) {
         defaultBindings[hmp::action::etc] = stream_t( device_e::keyboard, SDL_SCANCODE_G );
         defaultBindings[hmp::action::_length] = llce::input::INPUT_UNBOUND_ID;
     }
-    pInput->mBinding = llce::input::binding_t( &defaultBindings[0] );
+    *pInput->mBinding = llce::input::binding_t( &defaultBindings[0] );
 
     // Initialize Per-Mode Variables //
 
@@ -148,6 +148,14 @@ void scoreboard_t::tally( const int8_t pWestDelta, const int8_t pEastDelta ) {
 }
 
 
+// NOTE(JRC): The scoreboard's appearance only depends on its scores (all other
+// render inputs are fixed at construction), so they suffice as its content key.
+uint64_t scoreboard_t::key() const {
+    return ( static_cast<uint64_t>(static_cast<uint8_t>(mScores[hmp::team::west])) << 8 ) |
+        static_cast<uint64_t>( static_cast<uint8_t>(mScores[hmp::team::east]) );
+}
+
+
 void scoreboard_t::render() const {
     llce::gfx::render_context_t entityRC( mBBox );
     llce::gfx::color_context_t entityCC( mColor );
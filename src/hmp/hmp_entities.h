@@ -116,6 +116,8 @@ class scoreboard_t : public entity_t {
     void render() const;
     void tally( const int8_t pWestDelta, const int8_t pEastDelta );
 
+    uint64_t key() const;
+
     /// Class Fields ///
 
     public:
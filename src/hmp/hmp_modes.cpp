@@ -1,9 +1,6 @@
 #include <cstring>
 #include <sstream>
 
-#include <SDL2/SDL_opengl.h>
-#include <SDL2/SDL_opengl_glext.h>
-
 #include <glm/common.hpp>
 #include <glm/geometric.hpp>
 #include <glm/gtx/vector_angle.hpp>
@@ -43,10 +40,18 @@ const static auto SFX_MENU_SELECT = llce::sfx::waveform::sawtooth<'c', 0, 5>;
 
 /// Helper Functions ///
 
-void render_gameboard( const hmp::state_t* pState, const hmp::input_t* pInput, const hmp::output_t* pOutput ) {
-    llce::gfx::fbo_context_t simFBOC(
-        pOutput->gfxBufferFBOs[hmp::GFX_BUFFER_SIM_ID],
-        pOutput->gfxBufferRess[hmp::GFX_BUFFER_SIM_ID] );
+// NOTE(JRC): Each layer render function returns the content key for its layer,
+// and only renders the layer if its current contents don't match that key (see
+// 'llce::gfx::stale'). The game board is only static while the round is paused.
+uint64_t render_gameboard( const hmp::state_t* pState, const hmp::input_t* pInput, const hmp::output_t* pOutput ) {
+    const uint32_t simFBO = pOutput->gfxBufferFBOs[hmp::GFX_BUFFER_SIM_ID];
+    const vec2u32_t simRes = pOutput->gfxBufferRess[hmp::GFX_BUFFER_SIM_ID];
+    const uint64_t simKey = pState->roundPaused ? 0 : llce::gfx::CONTENT_UNKEYED;
+    if( !llce::gfx::stale(simFBO, simRes, simKey) ) {
+        return simKey;
+    }
+
+    llce::gfx::fbo_context_t simFBOC( simFBO, simRes, simKey );
 
     if( pState->roundPaused ) {
         llce::gfx::color_context_t boardCC( &hmp::color::BACKGROUND );
@@ -71,40 +76,51 @@ void render_gameboard( const hmp::state_t* pState, const hmp::input_t* pInput, c
             llce::gfx::render::vector( ball.mBBox.mid(), ball.mVel, 0.15f );
         }
     }
+
+    return simKey;
 }
 
 
-void render_scoreboard( const hmp::state_t* pState, const hmp::input_t* pInput, const hmp::output_t* pOutput ) {
-    llce::gfx::fbo_context_t simFBOC(
-        pOutput->gfxBufferFBOs[hmp::GFX_BUFFER_UI_ID],
-        pOutput->gfxBufferRess[hmp::GFX_BUFFER_UI_ID] );
+uint64_t render_scoreboard( const hmp::state_t* pState, const hmp::input_t* pInput, const hmp::output_t* pOutput ) {
+    const uint32_t uiFBO = pOutput->gfxBufferFBOs[hmp::GFX_BUFFER_UI_ID];
+    const vec2u32_t uiRes = pOutput->gfxBufferRess[hmp::GFX_BUFFER_UI_ID];
+    const uint64_t uiKey = pState->scoreEnt.key();
+    if( !llce::gfx::stale(uiFBO, uiRes, uiKey) ) {
+        return uiKey;
+    }
 
+    llce::gfx::fbo_context_t uiFBOC( uiFBO, uiRes, uiKey );
     pState->scoreEnt.render();
+
+    return uiKey;
 }
 
 
-void render_rasterize( const hmp::state_t* pState, const hmp::input_t* pInput, const hmp::output_t* pOutput ) {
+// NOTE(JRC): The master layer is composited from all of the other layers in a
+// single pass of color blits, so it's only stale if any of those layers are.
+void render_rasterize( const hmp::state_t* pState, const hmp::input_t* pInput, const hmp::output_t* pOutput,
+        const uint64_t pSimKey, const uint64_t pUIKey ) {
     const uint32_t masterFBO = pOutput->gfxBufferFBOs[hmp::GFX_BUFFER_MASTER_ID];
     const vec2u32_t masterRes = pOutput->gfxBufferRess[hmp::GFX_BUFFER_MASTER_ID];
-    llce::gfx::fbo_context_t masterFBOC( masterFBO, masterRes );
+    const uint64_t masterKey = ( pSimKey == llce::gfx::CONTENT_UNKEYED || pUIKey == llce::gfx::CONTENT_UNKEYED ) ?
+        llce::gfx::CONTENT_UNKEYED : ( pSimKey << 32 ) | pUIKey;
+    if( !llce::gfx::stale(masterFBO, masterRes, masterKey) ) {
+        return;
+    }
+
+    llce::gfx::fbo_context_t masterFBOC( masterFBO, masterRes, masterKey );
 
     llce::gfx::color_context_t hmpCC( &hmp::color::BACKGROUND );
     llce::gfx::render::box();
 
     for( uint32_t gfxBufferIdx = 0; gfxBufferIdx < hmp::GFX_BUFFER_COUNT; gfxBufferIdx++ ) {
-        const uint32_t gfxBufferFBO = pOutput->gfxBufferFBOs[gfxBufferIdx];
-        const vec2u32_t& gfxBufferRes = pOutput->gfxBufferRess[gfxBufferIdx];
-        const llce::box_t& gfxBufferBox = pOutput->gfxBufferBoxs[gfxBufferIdx];
-
-        glBindFramebuffer( GL_READ_FRAMEBUFFER, gfxBufferFBO );
-        glBindFramebuffer( GL_DRAW_FRAMEBUFFER, masterFBO );
-        for( uint32_t bufferTypeIdx = 0; bufferTypeIdx < 2; bufferTypeIdx++ ) {
-            glBlitFramebuffer( 0, 0, gfxBufferRes.x, gfxBufferRes.y,
-                gfxBufferBox.min().x * masterRes.x, gfxBufferBox.min().y * masterRes.y,
-                gfxBufferBox.max().x * masterRes.x, gfxBufferBox.max().y * masterRes.y,
-                bufferTypeIdx ? GL_COLOR_BUFFER_BIT : GL_DEPTH_BUFFER_BIT,
-                bufferTypeIdx ? GL_LINEAR : GL_NEAREST );
+        if( gfxBufferIdx == hmp::GFX_BUFFER_MASTER_ID ) {
+            continue;
         }
+        llce::gfx::blit(
+            pOutput->gfxBufferFBOs[gfxBufferIdx],
+            pOutput->gfxBufferRess[gfxBufferIdx],
+            pOutput->gfxBufferBoxs[gfxBufferIdx] );
     }
 }
 
@@ -258,9 +274,9 @@ bool32_t game::update( hmp::state_t* pState, hmp::input_t* pInput, const float64
 
 
 bool32_t game::render( const hmp::state_t* pState, const hmp::input_t* pInput, const hmp::output_t* pOutput ) {
-    render_gameboard( pState, pInput, pOutput );
-    render_scoreboard( pState, pInput, pOutput );
-    render_rasterize( pState, pInput, pOutput );
+    const uint64_t simKey = render_gameboard( pState, pInput, pOutput );
+    const uint64_t uiKey = render_scoreboard( pState, pInput, pOutput );
+    render_rasterize( pState, pInput, pOutput, simKey, uiKey );
 
     return true;
 }
@@ -367,8 +383,8 @@ bool32_t reset::render( const hmp::state_t* pState, const hmp::input_t* pInput,
         pState->resetMenu.render();
     }
 
-    render_scoreboard( pState, pInput, pOutput );
-    render_rasterize( pState, pInput, pOutput );
+    const uint64_t uiKey = render_scoreboard( pState, pInput, pOutput );
+    render_rasterize( pState, pInput, pOutput, llce::gfx::CONTENT_UNKEYED, uiKey );
 
     return true;
 }
@@ -15,12 +15,16 @@
 #include <fstream>
 
 #include "timer_t.h"
+#include "sampler_t.h"
+#include "encoder_t.h"
 #include "memory_t.h"
+#include "arena_t.h"
 #include "buffer_t.h"
 #include "path_t.h"
 #include "platform.h"
 #include "input.h"
 #include "output.h"
+#include "gfx.h"
 #include "cli.h"
 #include "box_t.h"
 #include "util.hpp"
@@ -49,6 +53,7 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
 
     const static float64_t csSimFPS = static_cast<float64_t>( LLCE_FPS );
     const static uint64_t csBackupBufferCount = LLCE_DEBUG ? 2 * LLCE_FPS : 0;
+    const static uint32_t csArenaFrameCount = 2;
 
     /// Parse Input Arguments ///
 
@@ -58,11 +63,16 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
             "Build: " << (LLCE_DEBUG ? "Debug" : "Release") << ", " <<
             "Libraries: " << (LLCE_DYLOAD ? "Dynamic" : "Static") << ", " <<
             "Floats: " << (LLCE_FDOUBLE ? "Double" : "Single") << "-Precision, " <<
+            "Memory: " << (LLCE_HUGEPAGES ? "Huge" : "Base") << "-Pages" <<
+                (LLCE_PREFAULT ? "/Prefault" : "") << (LLCE_MEMLOCK ? "/Locked" : "") << ", " <<
             "Capture*:" << (LLCE_CAPTURE ? "Enabled" : "Disabled") << "}" );
     }
 
+    // -x: render headlessly w/ the software rasterizer (no visible window or OpenGL context)
+    const bool32_t cIsHeadless = llce::cli::exists( "-x", pArgs, pArgCount );
+
     // -m: display a second window w/ meta information
-    const bool32_t cShowMeta = LLCE_DEBUG ? llce::cli::exists( "-m", pArgs, pArgCount ) : false;
+    const bool32_t cShowMeta = ( LLCE_DEBUG && !cIsHeadless ) ? llce::cli::exists( "-m", pArgs, pArgCount ) : false;
     const float32_t cShowMetaF = static_cast<float32_t>( cShowMeta );
 
     // -r [replay-id]: replay in simulation state
@@ -70,31 +80,87 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
     const int32_t cSimStateIdx = cSimStateArg != nullptr ? std::atoi( cSimStateArg ) : -1;
     const bool32_t cIsSimulating = LLCE_DEBUG ? cSimStateIdx > 0 : false;
 
+    // -l: measure input-to-photon latency (results in 'out/latency.csv')
+    // -lf: measure input-to-photon latency w/ a full pipeline fence after swaps
+    const bool32_t cFenceLatency = llce::cli::exists( "-lf", pArgs, pArgCount );
+    const bool32_t cMeasureLatency = llce::cli::exists( "-l", pArgs, pArgCount ) || cFenceLatency;
+
+    // -g: measure per-pass GPU render times (shown in meta window w/ '-m')
+    const bool32_t cMeasureGPU = llce::cli::exists( "-g", pArgs, pArgCount ) && !cIsHeadless;
+
+    // -d: dynamically scale simulation buffer resolutions to fit the frame time budget
+    const bool32_t cScaleDynamic = llce::cli::exists( "-d", pArgs, pArgCount ) && !cIsSimulating;
+
+    // NOTE(JRC): Frames whose simulation drawing and overlays exactly match those
+    // of the previous frame aren't rendered or presented, and the harness instead
+    // sleeps through the remainder of the frame. Idling is disabled in all modes
+    // that measure or display per-frame data.
+    const bool32_t cIdleStatic = !cIsSimulating && !cShowMeta && !cMeasureLatency && !cMeasureGPU;
+
     /// Initialize Application Memory/State ///
 
     // NOTE(JRC): This base address was chosen by following the steps enumerated
     // in the 'doc/static_address.md' documentation file.
     bit8_t* const cSimBufferAddress = LLCE_DEBUG ? (bit8_t*)0x0000100000000000 : nullptr;
     const uint64_t cSimBufferLength = llce::util::bytes<'M'>( 1 );
+    const uint64_t cSimArenaLength = llce::util::bytes<'K'>( 256 );
+    const uint64_t cSimListLength = llce::util::bytes<'K'>( 256 );
     const uint64_t cSimDataLength = sizeof( llsim::state_t ) + sizeof( llsim::input_t ) +
-        sizeof( llsim::output_t ) + 4 * sizeof( size_t );
-
-    llce::memory_t simMemory( cSimBufferLength, cSimDataLength, cSimBufferAddress );
+        sizeof( llce::input::binding_t ) + sizeof( llsim::output_t ) + cSimArenaLength +
+        cSimListLength + 7 * sizeof( size_t );
+    const uint32_t cSimBufferFlags =
+        ( LLCE_HUGEPAGES ? llce::platform::alloc::hugepage : 0 ) |
+        ( LLCE_PREFAULT ? llce::platform::alloc::prefault : 0 ) |
+        ( LLCE_MEMLOCK ? llce::platform::alloc::lock : 0 );
+    const uint32_t cSimSnapshotFlags = LLCE_DEBUG ? llce::platform::alloc::snapshot : 0;
+
+    llce::memory_t simMemory( cSimBufferLength, cSimDataLength, cSimBufferAddress, cSimBufferFlags | cSimSnapshotFlags );
     llsim::state_t* simState = (llsim::state_t*)simMemory.dalloc( sizeof(llsim::state_t) );
     llsim::input_t* simInput = (llsim::input_t*)simMemory.dalloc( sizeof(llsim::input_t) );
+    llce::input::binding_t* simBinding = (llce::input::binding_t*)simMemory.dalloc( sizeof(llce::input::binding_t) );
     llsim::output_t* simOutput = (llsim::output_t*)simMemory.dalloc( sizeof(llsim::output_t) );
 
+    // NOTE(JRC): The frame arena is reset by the harness at the start of every
+    // simulated frame, so its allocations are only valid for the frame in which
+    // they're made (and the one following it, given 'csArenaFrameCount' > 1).
+    llce::arena_t simArena( simMemory.dalloc(cSimArenaLength), cSimArenaLength, csArenaFrameCount );
+
+    // NOTE(JRC): The simulation's drawing is recorded into this list each frame
+    // and then executed by the harness, which keeps the simulation's rendering
+    // independent of how (and when) its commands are actually submitted.
+    llce::gfx::list_t simList( simMemory.dalloc(cSimListLength), cSimListLength );
+    uint32_t simListPeakCount = 0;
+
 #if LLCE_DEBUG
-    // NOTE(JRC): This workaround for 'allocating' the 'backupStates' and 'backupInputs'
-    // arrays is necessary because C++ default initialize the members of class/struct arrays
-    // and the 'state_t'/'input_t' types do not support such initialization options.
-    static bit8_t sBackupStateBuffer[csBackupBufferCount * sizeof(llsim::state_t)];
-    llsim::state_t* backupStates = (llsim::state_t*)&sBackupStateBuffer[0];
-    static bit8_t sBackupInputBuffer[csBackupBufferCount * sizeof(llsim::input_t)];
-    llsim::state_t* backupInputs = (llsim::state_t*)&sBackupInputBuffer[0];
+    // NOTE(JRC): The backup buffers are touched in their entirety every few
+    // seconds, so they're allocated with the same policies as the simulation
+    // memory to avoid page faults and TLB misses as the rings fill.
+    const uint64_t cBackupDataLength = csBackupBufferCount * sizeof( llsim::state_t ) + 2 * sizeof( size_t );
+    llce::memory_t backupMemory( cBackupDataLength, cBackupDataLength, nullptr, cSimBufferFlags );
+    llsim::state_t* backupStates = (llsim::state_t*)backupMemory.dalloc(
+        csBackupBufferCount * sizeof(llsim::state_t) );
+
+    // NOTE(JRC): The backup inputs are kept in a mirrored ring so that the whole
+    // backup window can be written to a slot file in one contiguous write. The
+    // ring has room for at least one frame beyond the window since full and
+    // empty rings are indistinguishable.
+    const uint64_t cBackupInputWindow = csBackupBufferCount * llsim::input_t::FRAME_BYTES;
+    const uint64_t cBackupInputLength = llce::platform::allocLength( cBackupInputWindow + llsim::input_t::FRAME_BYTES );
+    bit8_t* backupInputBuffer = llce::platform::allocMirror( cBackupInputLength );
+    LLCE_ASSERT_ERROR( backupInputBuffer != nullptr,
+        "Failed to allocate mirrored backup input buffer of length " << cBackupInputLength << "." );
+    buffer_t backupInputs( backupInputBuffer, cBackupInputLength, true );
 #endif
 
+    // NOTE(JRC): The simulation's bindings live in its memory so that they persist
+    // across hotloads and are restored along with snapshots, but they're kept
+    // apart from its per-frame input (see 'llce::input::input_t::FRAME_BYTES').
+    *simBinding = llce::input::binding_t();
+    simInput->mBinding = simBinding;
+
+    llce::input::binding_t baseBinding;
     llsim::input_t baseInput;
+    baseInput.mBinding = &baseBinding;
 
 #if LLCE_DEBUG
     // NOTE(JRC): The 'meta' module doesn't participate in loop-live editing, so its
@@ -106,7 +172,7 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
     meta::output_t* metaOutput = &metaOutputData;
 #endif
 
-    std::fstream recStateStream, recInputStream;
+    std::fstream recStateStream, recInputStream, recBindingStream;
     const ioflag_t cIOModeR = std::fstream::binary | std::fstream::in;
     const ioflag_t cIOModeW = std::fstream::binary | std::fstream::out | std::fstream::trunc;
 
@@ -129,7 +195,9 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
     const path_t cOutputPath( 2, cInstallPath.cstr(), "out" );
     const char8_t* cStateFileFormat = "state%u.dat";
     const char8_t* cInputFileFormat = "input%u.dat";
+    const char8_t* cBindingFileFormat = "binding%u.dat";
     const char8_t* cRenderFileFormat = "render%u-%u.png";
+    const char8_t* cLatencyFileName = "latency.csv";
     const static int32_t csOutputFileNameLength = 20;
 
     /// Load Dynamic Shared Libraries ///
@@ -266,29 +334,22 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
                 cViewportBoxs[viewportIdx].mPos.y * windowDims.y
             };
         }
+        llce::gfx::state::window( windowDims );
     };
 
     const auto cResetViewport = [ &viewportRess, &viewportPoss ] ( const uint32_t pViewportIdx ) {
-        glViewport(
-            viewportPoss[pViewportIdx].x, viewportPoss[pViewportIdx].y,
-            viewportRess[pViewportIdx].x, viewportRess[pViewportIdx].y );
-        glScissor(
-            viewportPoss[pViewportIdx].x, viewportPoss[pViewportIdx].y,
-            viewportRess[pViewportIdx].x, viewportRess[pViewportIdx].y );
-
-        glMatrixMode( GL_PROJECTION );
-        glLoadIdentity();
-        glOrtho( -1.0f, +1.0f, -1.0f, +1.0f, -1.0f, +1.0f );
-
-        glMatrixMode( GL_MODELVIEW );
-        glLoadIdentity();
+        llce::gfx::state::viewport( viewportPoss[pViewportIdx], viewportRess[pViewportIdx] );
+        llce::gfx::state::scissor( viewportPoss[pViewportIdx], viewportRess[pViewportIdx] );
+        llce::gfx::state::projection( glm::ortho(-1.0f, +1.0f, -1.0f, +1.0f, -1.0f, +1.0f) );
+        llce::gfx::state::modelview( mat4f32_t(1.0f) );
     };
 
     SDL_Window* window = nullptr;
     SDL_GLContext windowGL = nullptr;
 
-    const uint32_t cWindowFlags = SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE |
-        ( cIsSimulating ? SDL_WINDOW_HIDDEN : 0 );
+    const uint32_t cWindowFlags = SDL_WINDOW_RESIZABLE |
+        ( cIsHeadless ? 0 : SDL_WINDOW_OPENGL ) |
+        ( (cIsSimulating || cIsHeadless) ? SDL_WINDOW_HIDDEN : 0 );
 
     { // Initialize Window //
         window = SDL_CreateWindow(
@@ -327,7 +388,10 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
         SDL_FreeSurface( windowIcon );
     }
 
-    { // Initialize Window Graphics //
+    bool32_t hasGPUTimers = false;
+    if( cIsHeadless ) { // Initialize Software Graphics //
+        llce::gfx::select( llce::gfx::backend::soft );
+    } else { // Initialize Window Graphics //
         LLCE_ASSERT_ERROR(
             (windowGL = SDL_GL_CreateContext(window)) != nullptr,
             "SDL failed to generate OpenGL context; " << SDL_GetError() );
@@ -359,6 +423,13 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
             glColorMask( GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE );
             glClearColor( 0.0f, 0.0f, 0.0f, 0.0f );
         }
+
+        if( cMeasureGPU || cScaleDynamic ) { // Initialize OpenGL Timers //
+            hasGPUTimers = SDL_GL_ExtensionSupported( "GL_ARB_timer_query" );
+            LLCE_CHECK_WARNING( hasGPUTimers,
+                "Failed to load OpenGL extension 'GL_ARB_timer_query'; GPU times won't be measured." );
+            llce::gfx::profile( hasGPUTimers );
+        }
     }
 
     /// Initialize Audio ///
@@ -428,7 +499,7 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
     const uint32_t cFPSTextureID = 0, cRecTextureID = 1, cRepTextureID = 2, cTimeTextureID = 3, cSpeedTextureID = 4;
 
     const uint32_t cTextureCount = LLCE_ELEM_COUNT( textureGLIDs );
-    for( uint32_t textureIdx = 0; textureIdx < cTextureCount; textureIdx++ ) {
+    for( uint32_t textureIdx = 0; textureIdx < cTextureCount && !cIsHeadless; textureIdx++ ) {
         uint32_t& textureGLID = textureGLIDs[textureIdx];
         glGenTextures( 1, &textureGLID );
         glBindTexture( GL_TEXTURE_2D, textureGLID );
@@ -467,13 +538,15 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
         SDL_FreeSurface( textSurface );
     };
 
-    for( uint32_t textureIdx = 0; textureIdx < cTextureCount; textureIdx++ ) {
+    for( uint32_t textureIdx = 0; textureIdx < cTextureCount && !cIsHeadless; textureIdx++ ) {
         cGenerateTextTexture( textureIdx, textureColors[textureIdx], textureTexts[textureIdx] );
     }
 #endif
 
-    const static uint32_t csCaptureBufferSize = LLCE_CAPTURE ? LLCE_MAX_RESOLUTION * LLCE_MAX_RESOLUTION : 1;
-    static color4u8_t sCaptureBuffer[csCaptureBufferSize];
+#if LLCE_CAPTURE
+    const static uint32_t csCaptureBufferSize = LLCE_MAX_RESOLUTION * LLCE_MAX_RESOLUTION;
+    llce::encoder_t captureEncoder( csCaptureBufferSize * sizeof(color4u8_t) );
+#endif
 
     /// Input Wrangling ///
 
@@ -482,6 +555,37 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
     // with application-level functionality (e.g. debugging contexts, etc.).
     llsim::input_t* appInput = &baseInput;
 
+    // NOTE(JRC): The sampler timestamps transitions as they're pumped (see
+    // 'sampler_t::sample'), which the harness does at a high frequency while
+    // waiting between frames so that sub-frame taps can reach the simulation.
+    llce::sampler_t inputSampler;
+    llce::input::edge_t inputEdges[llsim::input_t::MAX_EDGES];
+
+    // NOTE(JRC): An input's latency is measured as the time between its edge
+    // and the return of the first buffer swap after the read that included it
+    // (or the completion of the pipeline for fenced measurements).
+    std::ofstream latencyStream;
+    if( cMeasureLatency ) {
+        const path_t cLatencyFilePath( 2, cOutputPath.cstr(), cLatencyFileName );
+        latencyStream.open( cLatencyFilePath, std::ofstream::out | std::ofstream::trunc );
+        latencyStream << "frame,input,age_ms,swap_ms,latency_ms" << std::endl;
+        LLCE_VERIFY_WARNING( latencyStream.is_open(),
+            "Failed to open latency output file at path '" << cLatencyFilePath << "'." );
+    }
+    const float64_t cLatencyTickRate = static_cast<float64_t>( SDL_GetPerformanceFrequency() );
+    uint64_t latencyReadTicks = 0;
+    uint64_t latencyCount = 0;
+    float64_t latencySum = 0.0;
+
+    // NOTE(JRC): GPU times are reported a few frames after they're measured (see
+    // 'llce::gfx::timings'), so each sample describes a slightly older frame.
+    const static char8_t* csGPUPassNames[] = { "Layer", "Composite", "Present", "Overlay", "Capture" };
+    static_assert( LLCE_ELEM_COUNT(csGPUPassNames) == llce::gfx::pass::_length,
+        "Unexpected number of GPU passes; all passes must be named." );
+    float64_t gpuPassSecs[llce::gfx::pass::_length];
+    float64_t gpuPassSums[llce::gfx::pass::_length] = {};
+    uint64_t gpuCount = 0;
+
     const auto cIsKeyDown = [] ( const llsim::input_t* pInput, const SDL_Scancode pKeyCode ) {
         return pInput->isDownRaw( llce::input::stream_t(llce::input::device::keyboard, pKeyCode) );
     };
@@ -514,6 +618,29 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
     bool32_t isRecording = false, isReplaying = false;
     uint32_t currSlotIdx = 0, recSlotIdx = 0;
     uint32_t repFrameIdx = 0, recFrameCount = 0;
+    bool32_t hasRepSnapshot = false;
+
+#if LLCE_DEBUG
+    uint32_t recBindingVersion = 0;
+
+    // NOTE(JRC): Binding changes are rare, so they're logged as separate events
+    // (i.e. the frame index at which they take effect followed by the full binding
+    // table) instead of being recorded alongside the input for every frame.
+    const auto cWriteBinding = [ &recBindingStream, &simBinding, &recBindingVersion ] ( uint32_t pFrameIdx ) {
+        recBindingStream.write( (bit8_t*)&pFrameIdx, sizeof(pFrameIdx) );
+        recBindingStream.write( (bit8_t*)simBinding, sizeof(llce::input::binding_t) );
+        recBindingVersion = simBinding->mVersion;
+    };
+    const auto cReadBinding = [ &recBindingStream, &simBinding ] ( uint32_t pFrameIdx ) {
+        uint32_t bindingFrameIdx = 0;
+        while( recBindingStream.read((bit8_t*)&bindingFrameIdx, sizeof(bindingFrameIdx)) &&
+                bindingFrameIdx <= pFrameIdx ) {
+            recBindingStream.read( (bit8_t*)simBinding, sizeof(llce::input::binding_t) );
+        } if( recBindingStream ) {
+            recBindingStream.seekg( -(int64_t)sizeof(bindingFrameIdx), std::ios_base::cur );
+        }
+    };
+#endif
 
     int32_t simSpeedFactor = 0;
 
@@ -527,11 +654,38 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
     // that this increments very quickly over time isn't a big concern.
     uint64_t simFrame = 0;
 
+    // NOTE(JRC): Dynamic scaling steps down a level whenever the mean busy time
+    // over a window of frames nears the frame budget and steps back up once it's
+    // comfortably within it, with a gap between the two thresholds to keep the
+    // scale from oscillating. A frame's busy time is the greater of its CPU time
+    // before the buffer swap (which blocks on vsync) and its GPU time; since GL
+    // calls are asynchronous, the GPU time is measured with timer queries (see
+    // 'llce::gfx::timings') or, if those are unavailable, by fencing the frame
+    // before the swap so that the CPU time includes all of its GPU work.
+    const static float32_t csScaleLevels[] = { 1.0f, 0.9f, 0.8f, 0.7f, 0.6f, 0.5f };
+    const static uint32_t csScaleLevelCount = LLCE_ELEM_COUNT( csScaleLevels );
+    const static uint32_t csScaleWindow = LLCE_FPS / 2;
+    const static float64_t csScaleDownRatio = 0.9, csScaleUpRatio = 0.6;
+    uint32_t scaleLevel = 0, scaleFrameCount = 0;
+    float64_t scaleBusySum = 0.0;
+    uint64_t scaleStartTicks = 0;
+    float64_t scaleGPUSecs = 0.0;
+
+    // NOTE(JRC): Static frames are decided from the simulation's drawing alone, which
+    // doesn't capture state that has yet to become visible (e.g. timers), so the
+    // simulation is still stepped at the full frame rate while idling and only the
+    // execute/composite/present stages are skipped.
+    uint64_t prevListKey = llce::gfx::CONTENT_UNKEYED, prevOverlayKey = llce::gfx::CONTENT_UNKEYED;
+    bool32_t isFrameStatic = false, isFrameStale = true;
+
     isRunning &= dllInit( simState, simInput );
     isRunning &= dllBoot( simOutput );
+    simOutput->memFrameArena = &simArena;
 #if LLCE_DEBUG
     if( cShowMeta ) {
         isRunning &= meta::init( metaState, metaInput );
+        metaState->mode = cMeasureLatency ? meta::mode::latency :
+            ( cMeasureGPU ? meta::mode::gpu : metaState->mode );
         isRunning &= meta::boot( metaOutput );
     }
 #endif
@@ -551,6 +705,7 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
 
     while( isRunning ) {
         simTimer.split();
+        scaleStartTicks = SDL_GetPerformanceCounter();
 
 #if LLCE_DEBUG
         LLCE_ASSERT_ERROR(
@@ -592,6 +747,7 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
                    event.window.event == SDL_WINDOWEVENT_EXPOSED) ) {
                 SDL_GetWindowSize( window, &windowDims.x, &windowDims.y );
                 cRecalcViewports();
+                isFrameStale = true;
             }
         }
 
@@ -631,36 +787,47 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
 
             char8_t slotStateFileName[csOutputFileNameLength];
             char8_t slotInputFileName[csOutputFileNameLength];
+            char8_t slotBindingFileName[csOutputFileNameLength];
 
             std::snprintf( &slotStateFileName[0], sizeof(slotStateFileName),
                 cStateFileFormat, recSlotIdx );
             std::snprintf( &slotInputFileName[0], sizeof(slotInputFileName),
                 cInputFileFormat, recSlotIdx );
+            std::snprintf( &slotBindingFileName[0], sizeof(slotBindingFileName),
+                cBindingFileFormat, recSlotIdx );
 
             path_t slotStateFilePath( 2, cOutputPath.cstr(), &slotStateFileName[0] );
             path_t slotInputFilePath( 2, cOutputPath.cstr(), &slotInputFileName[0] );
+            path_t slotBindingFilePath( 2, cOutputPath.cstr(), &slotBindingFileName[0] );
 
             if( (cIsKeyDown(appInput, SDL_SCANCODE_LSHIFT) && !isRecording) || cIsSimulating ) {
                 // lshift + fx = toggle slot x replay
                 LLCE_INFO_DEBUG( "Replay Slot {" << recSlotIdx << "} <" << (!isReplaying ? "ON " : "OFF") << ">" );
+                hasRepSnapshot = false;
                 if( !isReplaying ) {
                     repFrameIdx = 0;
                     recStateStream.open( slotStateFilePath, cIOModeR );
                     recInputStream.open( slotInputFilePath, cIOModeR );
+                    recBindingStream.open( slotBindingFilePath, cIOModeR );
 
                     recFrameCount = (uint32_t)recInputStream.tellg();
                     recInputStream.seekg( 0, std::ios_base::end );
                     recFrameCount = (uint32_t)recInputStream.tellg() - recFrameCount;
-                    recFrameCount /= sizeof( llsim::input_t );
+                    recFrameCount /= llsim::input_t::FRAME_BYTES;
                 } else {
                     repFrameIdx = 0;
                     recStateStream.close();
                     recInputStream.close();
+                    recBindingStream.close();
                 }
                 isReplaying = !isReplaying;
             } else if( cIsKeyDown(appInput, SDL_SCANCODE_RSHIFT) && !isRecording ) {
                 // rshift + fx = hotload slot x state (reset replay)
                 LLCE_INFO_DEBUG( "Hotload Slot {" << recSlotIdx << "}" );
+                // NOTE(JRC): Hotloads during replay restart the loop, which restores
+                // the state through the memory snapshot; otherwise, the state only
+                // exists in the slot file, so it's read in full (the one snapshot of
+                // 'simMemory' is reserved for replays and can't cache every slot).
                 if( isReplaying ) {
                     repFrameIdx = 0;
                     recInputStream.seekg( 0, std::ios_base::end );
@@ -679,27 +846,35 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
                     recStateStream.write( (bit8_t*)simState, sizeof(llsim::state_t) );
                     recStateStream.close();
                     recInputStream.open( slotInputFilePath, cIOModeW );
+                    recBindingStream.open( slotBindingFilePath, cIOModeW );
+                    cWriteBinding( 0 );
                 } else {
                     recInputStream.close();
+                    recBindingStream.close();
                 }
                 isRecording = !isRecording;
             } else if( recSlotIdx == 1 && !isReplaying ) {
                 // f1 = instant backup record
                 LLCE_INFO_DEBUG( "Hotsave Slot {" << recSlotIdx << "}" );
-                // TODO(JRC): It's potentially worth putting a guard on this
-                // function or improving the backup state implementation so
-                // that hot-saving before the number of total backups is possible.
-                uint64_t backupStartIdx = simFrame % csBackupBufferCount;
+                // NOTE(JRC): The hotsave state is taken from the backup ring rather
+                // than the memory snapshot since it's from the start of the backup
+                // window (a snapshot only ever holds one committed state), so the
+                // full state is copied to the slot file.
+                const uint64_t cBackupFrameCount = backupInputs.length() / llsim::input_t::FRAME_BYTES;
+                uint64_t backupStartIdx = ( simFrame + csBackupBufferCount - cBackupFrameCount ) % csBackupBufferCount;
                 recStateStream.open( slotStateFilePath, cIOModeW );
                 recStateStream.write( (bit8_t*)&backupStates[backupStartIdx], sizeof(llsim::state_t) );
                 recStateStream.close();
 
                 recInputStream.open( slotInputFilePath, cIOModeW );
-                for( uint32_t bufferIdx = 0; bufferIdx < csBackupBufferCount; bufferIdx++ ) {
-                    uint64_t bbIdx = (backupStartIdx + bufferIdx) % csBackupBufferCount;
-                    recInputStream.write( (bit8_t*)&backupInputs[bbIdx], sizeof(llsim::input_t) );
-                }
+                recInputStream.write( backupInputs.front(), backupInputs.length() );
                 recInputStream.close();
+
+                // TODO(JRC): Binding changes made within the backup window aren't
+                // tracked, so the hotsave always uses the current bindings.
+                recBindingStream.open( slotBindingFilePath, cIOModeW );
+                cWriteBinding( 0 );
+                recBindingStream.close();
             }
         }
 #endif
@@ -721,27 +896,85 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
             }
         }
 
+        inputSampler.sample();
+
+        isFrameStatic = false;
         if( doStep ) {
-            simInput->read();
+            // NOTE(JRC): Edges are only flushed on stepped frames so that any that
+            // arrive while the simulation is paused stay queued until the next step
+            // instead of being lost (which could leave buttons stuck down).
+            const uint32_t cInputEdgeCount = inputSampler.flush( &inputEdges[0], llsim::input_t::MAX_EDGES );
+            simArena.flip();
+            latencyReadTicks = SDL_GetPerformanceCounter();
+            simInput->read( llce::input::device::unbound, &inputEdges[0], cInputEdgeCount );
 #if LLCE_DEBUG
             if( isRecording ) {
-                recInputStream.write( (bit8_t*)simInput, sizeof(llsim::input_t) );
+                if( simBinding->mVersion != recBindingVersion ) {
+                    cWriteBinding( recFrameCount );
+                }
+                recInputStream.write( (bit8_t*)simInput, llsim::input_t::FRAME_BYTES );
                 recFrameCount++;
             } if( isReplaying ) {
                 if( recInputStream.peek() == EOF || recInputStream.eof() ) {
                     isRunning = !( cIsSimulating && repFrameIdx != 0 );
                     repFrameIdx = 0;
-                    recStateStream.seekg( 0 );
-                    recStateStream.read( (bit8_t*)simState, sizeof(llsim::state_t) );
+                    // NOTE(JRC): The replay's initial state is loaded once and then
+                    // committed as a snapshot of the simulation memory, which allows
+                    // all subsequent loops to restore it by discarding modified pages.
+                    // The output is preserved since it's configured per-frame by the harness.
+                    if( !hasRepSnapshot ) {
+                        recStateStream.seekg( 0 );
+                        recStateStream.read( (bit8_t*)simState, sizeof(llsim::state_t) );
+                        hasRepSnapshot = simMemory.commit();
+                    } else {
+                        const llsim::output_t cSimOutput = *simOutput;
+                        simMemory.revert();
+                        *simOutput = cSimOutput;
+                    }
                     recInputStream.seekg( 0 );
+                    recBindingStream.clear();
+                    recBindingStream.seekg( 0 );
                 }
-                recInputStream.read( (bit8_t*)simInput, sizeof(llsim::input_t) );
+                recInputStream.read( (bit8_t*)simInput, llsim::input_t::FRAME_BYTES );
+                cReadBinding( repFrameIdx );
                 repFrameIdx++;
             }
 #endif
 
+            if( cScaleDynamic ) {
+                llce::output::scale( *simOutput, csScaleLevels[scaleLevel] );
+            }
+
             isRunning &= dllUpdate( simState, simInput, simOutput, simDT );
+            llce::gfx::record( &simList );
             isRunning &= dllRender( simState, simInput, simOutput );
+            llce::gfx::record( nullptr );
+
+            // NOTE(JRC): Every frame buffer is cleared when its context is entered,
+            // so executing a list that's identical to the previous frame's list
+            // would reproduce the existing frame buffer contents exactly.
+            const uint64_t cListKey = simList.key();
+            const uint64_t cOverlayKey = LLCE_DEBUG ? (
+                (static_cast<uint64_t>(simSpeedFactor + 0x80) << 32) |
+                (static_cast<uint64_t>(isRecording) << 17) | (static_cast<uint64_t>(isReplaying) << 16) |
+                static_cast<uint64_t>(recSlotIdx) ) : 0;
+            isFrameStatic = cIdleStatic && !isFrameStale && !isCapturing &&
+                cListKey != llce::gfx::CONTENT_UNKEYED && cListKey == prevListKey &&
+                cOverlayKey == prevOverlayKey;
+            prevListKey = cListKey;
+            prevOverlayKey = cOverlayKey;
+            isFrameStale = false;
+
+            if( !isFrameStatic ) {
+                llce::gfx::execute( simList );
+                llce::gfx::finish();
+            }
+
+            uint32_t simListCount = 0;
+            for( uint32_t commandIdx = 0; commandIdx < llce::gfx::command::_length; commandIdx++ ) {
+                simListCount += simList.mCounts[commandIdx];
+            }
+            simListPeakCount = std::max( simListPeakCount, simListCount );
 
 #if LLCE_DEBUG
             // TODO(JRC): It may be worth experimenting with allowing for the
@@ -750,19 +983,26 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
             if( !isRecording && !isReplaying ) {
                 uint64_t backupIdx = simFrame % csBackupBufferCount;
                 std::memcpy( (void*)&backupStates[backupIdx], (void*)simState, sizeof(llsim::state_t) );
-                std::memcpy( (void*)&backupInputs[backupIdx], (void*)simInput, sizeof(llsim::input_t) );
+                if( backupInputs.length() == cBackupInputWindow ) {
+                    backupInputs.dequeue( nullptr, llsim::input_t::FRAME_BYTES );
+                }
+                backupInputs.enqueue( (bit8_t*)simInput, llsim::input_t::FRAME_BYTES );
             }
 #endif
         }
 
-        glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
-        glPushMatrix(); {
+        if( !cIsHeadless && !isFrameStatic ) { // Composite Simulation Buffer //
+            llce::gfx::timer_context_t presentTC( llce::gfx::pass::present );
+            glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+
             // NOTE(JRC): This code calculates the normalized fit dimensions of
             // the simulation window (fixed aspect ratio) within the harness window
-            // (variable aspect ratio based on user window manipulation).
+            // (variable aspect ratio based on user window manipulation). Fits are
+            // based on the allocated buffer dimensions so that they're unaffected
+            // by dynamic scaling, which instead upscales the buffer's rendered region.
             vec2f32_t simFitDims; {
                 const vec2f32_t& cWindowDims = viewportRess[cSimViewportID];
-                const vec2f32_t& cSimDims = simOutput->gfxBufferRess[llce::output::BUFFER_SHARED_ID];
+                const vec2f32_t& cSimDims = simOutput->gfxBufferCaps[llce::output::BUFFER_SHARED_ID];
                 const float32_t cSimToWindowFactor =
                     ( llce::gfx::aspect(cWindowDims) < llce::gfx::aspect(cSimDims) ) ?
                     ( cWindowDims.x / (cSimDims.x + 0.0f) ) : ( cWindowDims.y / (cSimDims.y + 0.0f) );
@@ -776,22 +1016,26 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
             matWorldView *= glm::scale( vec3f32_t(2.0f, 2.0f, 1.0f) );
             matWorldView *= glm::translate( vec3f32_t((1.0f-cSimFitDims.x)/2.0f, (1.0f-cSimFitDims.y)/2.0f, 0.0f) );
             matWorldView *= glm::scale( vec3f32_t(cSimFitDims.x, cSimFitDims.y, 1.0f) );
-            glMultMatrixf( &matWorldView[0][0] );
+            llce::gfx::state::modelview( matWorldView );
+
+            const vec2u32_t& cSimRes = simOutput->gfxBufferRess[llce::output::BUFFER_SHARED_ID];
+            const vec2u32_t& cSimCap = simOutput->gfxBufferCaps[llce::output::BUFFER_SHARED_ID];
+            const vec2f32_t cSimTexDims( cSimRes.x / (cSimCap.x + 0.0f), cSimRes.y / (cSimCap.y + 0.0f) );
 
             glEnable( GL_TEXTURE_2D ); {
                 // NOTE(JRC): This is required to get the expected/correct texture color,
                 // but it's unclear as to why. OpenGL may perform color mixing by default?
-                glColor4ubv( (uint8_t*)&csWhiteColor );
+                llce::gfx::state::color( csWhiteColor );
                 glBindTexture( GL_TEXTURE_2D, simOutput->gfxBufferCBOs[llce::output::BUFFER_SHARED_ID] );
                 glBegin( GL_QUADS ); {
                     glTexCoord2f( 0.0f, 0.0f ); glVertex2f( 0.0f, 0.0f );
-                    glTexCoord2f( 0.0f, 1.0f ); glVertex2f( 0.0f, 1.0f );
-                    glTexCoord2f( 1.0f, 1.0f ); glVertex2f( 1.0f, 1.0f );
-                    glTexCoord2f( 1.0f, 0.0f ); glVertex2f( 1.0f, 0.0f );
+                    glTexCoord2f( 0.0f, cSimTexDims.y ); glVertex2f( 0.0f, 1.0f );
+                    glTexCoord2f( cSimTexDims.x, cSimTexDims.y ); glVertex2f( 1.0f, 1.0f );
+                    glTexCoord2f( cSimTexDims.x, 0.0f ); glVertex2f( 1.0f, 0.0f );
                 } glEnd();
                 glBindTexture( GL_TEXTURE_2D, 0 );
             } glDisable( GL_TEXTURE_2D );
-        } glPopMatrix();
+        } llce::gfx::state::modelview( mat4f32_t(1.0f) );
 
         if( csSimAudioEnabled && simOutput->sfxBufferFrames[llce::output::BUFFER_SHARED_ID] > 0 && !cIsSimulating ) {
             SDL_QueueAudio( audioDeviceID, &audioBuffer[0],
@@ -800,66 +1044,69 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
         }
 
 #if LLCE_DEBUG
-        glEnable( GL_TEXTURE_2D ); {
-            glColor4ubv( (uint8_t*)&csWhiteColor );
-
-            std::snprintf( &textureTexts[cFPSTextureID][0],
-                csTextureTextLength,
-                "FPS: %0.2f", 1.0 / simDT );
-            cGenerateTextTexture( cFPSTextureID, textureColors[cFPSTextureID], textureTexts[cFPSTextureID] );
-
-            glBindTexture( GL_TEXTURE_2D, textureGLIDs[cFPSTextureID] );
-            glBegin( GL_QUADS ); {
-                glTexCoord2f( 0.0f, 0.0f ); glVertex2f( -1.0f + 0.0f, -1.0f + 0.2f ); // UL
-                glTexCoord2f( 0.0f, 1.0f ); glVertex2f( -1.0f + 0.0f, -1.0f + 0.0f ); // BL
-                glTexCoord2f( 1.0f, 1.0f ); glVertex2f( -1.0f + 0.5f, -1.0f + 0.0f ); // BR
-                glTexCoord2f( 1.0f, 0.0f ); glVertex2f( -1.0f + 0.5f, -1.0f + 0.2f ); // UR
-            } glEnd();
-
-            std::snprintf( &textureTexts[cSpeedTextureID][0],
-                csTextureTextLength,
-                "Speed: %3.1fx", std::pow(2.0f, simSpeedFactor + 0.0f) );
-            cGenerateTextTexture( cSpeedTextureID, textureColors[cFPSTextureID], textureTexts[cSpeedTextureID] );
-
-            glBindTexture( GL_TEXTURE_2D, textureGLIDs[cSpeedTextureID] );
-            glBegin( GL_QUADS ); {
-                glTexCoord2f( 0.0f, 0.0f ); glVertex2f( +1.0f - 0.5f, -1.0f + 0.2f ); // UL
-                glTexCoord2f( 0.0f, 1.0f ); glVertex2f( +1.0f - 0.5f, -1.0f + 0.0f ); // BL
-                glTexCoord2f( 1.0f, 1.0f ); glVertex2f( +1.0f + 0.0f, -1.0f + 0.0f ); // BR
-                glTexCoord2f( 1.0f, 0.0f ); glVertex2f( +1.0f + 0.0f, -1.0f + 0.2f ); // UR
-            } glEnd();
-
-            if( isRecording || isReplaying ) {
-                uint32_t textureID = isRecording ? cRecTextureID : cRepTextureID;
-                std::snprintf( &textureTexts[textureID][0],
-                    csTextureTextLength, isRecording ?
-                    "Recording %02d" : "Replaying %02d",
-                    recSlotIdx );
-                cGenerateTextTexture( textureID, textureColors[textureID], textureTexts[textureID] );
-
-                glBindTexture( GL_TEXTURE_2D, textureGLIDs[textureID] );
+        if( !cIsHeadless && !isFrameStatic ) {
+            llce::gfx::timer_context_t overlayTC( llce::gfx::pass::overlay );
+            glEnable( GL_TEXTURE_2D ); {
+                llce::gfx::state::color( csWhiteColor );
+
+                std::snprintf( &textureTexts[cFPSTextureID][0],
+                    csTextureTextLength,
+                    "FPS: %0.2f", 1.0 / simDT );
+                cGenerateTextTexture( cFPSTextureID, textureColors[cFPSTextureID], textureTexts[cFPSTextureID] );
+
+                glBindTexture( GL_TEXTURE_2D, textureGLIDs[cFPSTextureID] );
                 glBegin( GL_QUADS ); {
-                    glTexCoord2f( 0.0f, 0.0f ); glVertex2f( -1.0f + 0.0f, +1.0f - 0.0f ); // UL
-                    glTexCoord2f( 0.0f, 1.0f ); glVertex2f( -1.0f + 0.0f, +1.0f - 0.2f ); // BL
-                    glTexCoord2f( 1.0f, 1.0f ); glVertex2f( -1.0f + 0.5f, +1.0f - 0.2f ); // BR
-                    glTexCoord2f( 1.0f, 0.0f ); glVertex2f( -1.0f + 0.5f, +1.0f - 0.0f ); // UR
+                    glTexCoord2f( 0.0f, 0.0f ); glVertex2f( -1.0f + 0.0f, -1.0f + 0.2f ); // UL
+                    glTexCoord2f( 0.0f, 1.0f ); glVertex2f( -1.0f + 0.0f, -1.0f + 0.0f ); // BL
+                    glTexCoord2f( 1.0f, 1.0f ); glVertex2f( -1.0f + 0.5f, -1.0f + 0.0f ); // BR
+                    glTexCoord2f( 1.0f, 0.0f ); glVertex2f( -1.0f + 0.5f, -1.0f + 0.2f ); // UR
                 } glEnd();
 
-                std::snprintf( &textureTexts[cTimeTextureID][0],
-                    csTextureTextLength, isRecording ?
-                    "%1u%010u" : "%05u/%05u",
-                    repFrameIdx, recFrameCount );
-                cGenerateTextTexture( cTimeTextureID, textureColors[textureID], textureTexts[cTimeTextureID] );
+                std::snprintf( &textureTexts[cSpeedTextureID][0],
+                    csTextureTextLength,
+                    "Speed: %3.1fx", std::pow(2.0f, simSpeedFactor + 0.0f) );
+                cGenerateTextTexture( cSpeedTextureID, textureColors[cFPSTextureID], textureTexts[cSpeedTextureID] );
 
-                glBindTexture( GL_TEXTURE_2D, textureGLIDs[cTimeTextureID] );
+                glBindTexture( GL_TEXTURE_2D, textureGLIDs[cSpeedTextureID] );
                 glBegin( GL_QUADS ); {
-                    glTexCoord2f( 0.0f, 0.0f ); glVertex2f( +1.0f - 0.6f, +1.0f - 0.0f ); // UL
-                    glTexCoord2f( 0.0f, 1.0f ); glVertex2f( +1.0f - 0.6f, +1.0f - 0.2f ); // BL
-                    glTexCoord2f( 1.0f, 1.0f ); glVertex2f( +1.0f - 0.0f, +1.0f - 0.2f ); // BR
-                    glTexCoord2f( 1.0f, 0.0f ); glVertex2f( +1.0f - 0.0f, +1.0f - 0.0f ); // UR
+                    glTexCoord2f( 0.0f, 0.0f ); glVertex2f( +1.0f - 0.5f, -1.0f + 0.2f ); // UL
+                    glTexCoord2f( 0.0f, 1.0f ); glVertex2f( +1.0f - 0.5f, -1.0f + 0.0f ); // BL
+                    glTexCoord2f( 1.0f, 1.0f ); glVertex2f( +1.0f + 0.0f, -1.0f + 0.0f ); // BR
+                    glTexCoord2f( 1.0f, 0.0f ); glVertex2f( +1.0f + 0.0f, -1.0f + 0.2f ); // UR
                 } glEnd();
-            }
-        } glDisable( GL_TEXTURE_2D );
+
+                if( isRecording || isReplaying ) {
+                    uint32_t textureID = isRecording ? cRecTextureID : cRepTextureID;
+                    std::snprintf( &textureTexts[textureID][0],
+                        csTextureTextLength, isRecording ?
+                        "Recording %02d" : "Replaying %02d",
+                        recSlotIdx );
+                    cGenerateTextTexture( textureID, textureColors[textureID], textureTexts[textureID] );
+
+                    glBindTexture( GL_TEXTURE_2D, textureGLIDs[textureID] );
+                    glBegin( GL_QUADS ); {
+                        glTexCoord2f( 0.0f, 0.0f ); glVertex2f( -1.0f + 0.0f, +1.0f - 0.0f ); // UL
+                        glTexCoord2f( 0.0f, 1.0f ); glVertex2f( -1.0f + 0.0f, +1.0f - 0.2f ); // BL
+                        glTexCoord2f( 1.0f, 1.0f ); glVertex2f( -1.0f + 0.5f, +1.0f - 0.2f ); // BR
+                        glTexCoord2f( 1.0f, 0.0f ); glVertex2f( -1.0f + 0.5f, +1.0f - 0.0f ); // UR
+                    } glEnd();
+
+                    std::snprintf( &textureTexts[cTimeTextureID][0],
+                        csTextureTextLength, isRecording ?
+                        "%1u%010u" : "%05u/%05u",
+                        repFrameIdx, recFrameCount );
+                    cGenerateTextTexture( cTimeTextureID, textureColors[textureID], textureTexts[cTimeTextureID] );
+
+                    glBindTexture( GL_TEXTURE_2D, textureGLIDs[cTimeTextureID] );
+                    glBegin( GL_QUADS ); {
+                        glTexCoord2f( 0.0f, 0.0f ); glVertex2f( +1.0f - 0.6f, +1.0f - 0.0f ); // UL
+                        glTexCoord2f( 0.0f, 1.0f ); glVertex2f( +1.0f - 0.6f, +1.0f - 0.2f ); // BL
+                        glTexCoord2f( 1.0f, 1.0f ); glVertex2f( +1.0f - 0.0f, +1.0f - 0.2f ); // BR
+                        glTexCoord2f( 1.0f, 0.0f ); glVertex2f( +1.0f - 0.0f, +1.0f - 0.0f ); // UR
+                    } glEnd();
+                }
+            } glDisable( GL_TEXTURE_2D );
+        }
 #endif
 
 #if LLCE_CAPTURE
@@ -871,9 +1118,8 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
                 sizeof(slotCaptureFileName),
                 cRenderFileFormat, recSlotIdx, currCaptureIdx++ );
             path_t capturePath( 2, cOutputPath.cstr(), slotCaptureFileName );
-
-            glEnable( GL_TEXTURE_2D );
-            glBindTexture( GL_TEXTURE_2D, simOutput->gfxBufferCBOs[llce::output::BUFFER_SHARED_ID] );
+            llce::encoder_t::frame_t* captureFrame = captureEncoder.reserve( capturePath, simFrame );
+            color4u8_t* captureBuffer = (color4u8_t*)captureFrame->mPixels;
 
             // TODO(JRC): Reversing the colors results in the proper color values,
             // but it's unclear why this is necessary given that they're stored
@@ -881,33 +1127,41 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
             // future when adapting this code to work on multiple platforms.
             bool8_t doWindowCapture = cIsKeyDown( appInput, SDL_SCANCODE_LSHIFT );
             vec2u32_t captureDims( 0, 0 );
-            if( doWindowCapture ) {
+            if( cIsHeadless ) {
+                // NOTE(JRC): Software frame buffers are stored bottom row first
+                // in RGBA order, which matches the OpenGL readbacks below.
+                const llce::raster_t* cSimRaster = llce::gfx::raster(
+                    simOutput->gfxBufferFBOs[llce::output::BUFFER_SHARED_ID] );
+                captureDims = simOutput->gfxBufferRess[llce::output::BUFFER_SHARED_ID];
+                for( uint32_t rowIdx = 0; rowIdx < captureDims.y; rowIdx++ ) {
+                    std::memcpy( &captureBuffer[rowIdx * captureDims.x],
+                        &cSimRaster->mPixels[rowIdx * cSimRaster->mRes.x],
+                        captureDims.x * sizeof(color4u8_t) );
+                }
+            } else if( doWindowCapture ) {
+                llce::gfx::timer_context_t captureTC( llce::gfx::pass::capture );
                 captureDims = windowDims;
-                glReadPixels( 0, 0, windowDims.x, windowDims.y, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8_REV, sCaptureBuffer );
+                glReadPixels( 0, 0, windowDims.x, windowDims.y, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8_REV, captureBuffer );
             } else { // if( doBufferCapture ) {
+                // NOTE(JRC): Dynamically scaled buffers only fill their bottom-left
+                // regions, so the full texture is read and then packed down in place.
+                llce::gfx::timer_context_t captureTC( llce::gfx::pass::capture );
+                const vec2u32_t& cSimCap = simOutput->gfxBufferCaps[llce::output::BUFFER_SHARED_ID];
                 captureDims = simOutput->gfxBufferRess[llce::output::BUFFER_SHARED_ID];
-                glGetTexImage( GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8_REV, sCaptureBuffer );
-            }
-
-            // TODO(JRC): Ultimately, it would be best if the data could just
-            // be funneled natively into the PNG interface instead of having
-            // to mirror it about the y=h/2 axis.
-            color4u8_t tempBuffer[LLCE_MAX_RESOLUTION];
-            uint32_t bufferByteCount = captureDims.x * sizeof( color4u8_t );
-            for( uint32_t rowIdx = 0; rowIdx < captureDims.y / 2; rowIdx++ ) {
-                uint32_t rowOff = rowIdx * captureDims.x;
-                uint32_t oppOff = ( captureDims.y - rowIdx - 1 ) * captureDims.x;
-                std::memcpy( tempBuffer, &sCaptureBuffer[rowOff], bufferByteCount );
-                std::memcpy( &sCaptureBuffer[rowOff], &sCaptureBuffer[oppOff], bufferByteCount );
-                std::memcpy( &sCaptureBuffer[oppOff], tempBuffer, bufferByteCount );
+                glBindTexture( GL_TEXTURE_2D, simOutput->gfxBufferCBOs[llce::output::BUFFER_SHARED_ID] );
+                glGetTexImage( GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8_REV, captureBuffer );
+                glBindTexture( GL_TEXTURE_2D, 0 );
+                for( uint32_t rowIdx = 1; rowIdx < captureDims.y && captureDims.x < cSimCap.x; rowIdx++ ) {
+                    std::memmove( &captureBuffer[rowIdx * captureDims.x],
+                        &captureBuffer[rowIdx * cSimCap.x], captureDims.x * sizeof(color4u8_t) );
+                }
             }
 
-            LLCE_VERIFY_WARNING(
-                llce::platform::pngSave(capturePath, (bit8_t*)&sCaptureBuffer[0], captureDims.x, captureDims.y),
-                "Failed to capture frame {" << simFrame << "} to path '" << capturePath << "'." );
-
-            glBindTexture( GL_TEXTURE_2D, 0 );
-            glDisable( GL_TEXTURE_2D );
+            // NOTE(JRC): Encoding (including the flip to top row first) happens on
+            // the encoder's thread, so the frame loop only pays for the readback.
+            captureFrame->mWidth = captureDims.x;
+            captureFrame->mHeight = captureDims.y;
+            captureEncoder.submit( captureFrame );
         }
         isCapturing = cIsSimulating;
 #endif
@@ -918,18 +1172,20 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
 
             isRunning &= meta::update( metaState, metaInput, metaOutput, simDT - std::min(0.0, simWT) );
             isRunning &= meta::render( metaState, metaInput, metaOutput );
+            llce::gfx::finish();
 
             glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
-            glPushMatrix(); {
+            { // Composite Meta Buffer //
+                llce::gfx::timer_context_t presentTC( llce::gfx::pass::present );
                 mat4f32_t matWorldView( 1.0f );
                 matWorldView *= glm::translate( vec3f32_t(-1.0f, -1.0f, 0.0f) );
                 matWorldView *= glm::scale( vec3f32_t(2.0f, 2.0f, 1.0f) );
-                glMultMatrixf( &matWorldView[0][0] );
+                llce::gfx::state::modelview( matWorldView );
 
                 glEnable( GL_TEXTURE_2D ); {
                     // NOTE(JRC): This is required to get the expected/correct texture color,
                     // but it's unclear as to why. OpenGL may perform color mixing by default?
-                    glColor4ubv( (uint8_t*)&csWhiteColor );
+                    llce::gfx::state::color( csWhiteColor );
                     glBindTexture( GL_TEXTURE_2D, metaOutput->gfxBufferCBOs[llce::output::BUFFER_SHARED_ID] );
                     glBegin( GL_QUADS ); {
                         glTexCoord2f( 0.0f, 0.0f ); glVertex2f( 0.0f, 0.0f );
@@ -939,18 +1195,92 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
                     } glEnd();
                     glBindTexture( GL_TEXTURE_2D, 0 );
                 } glDisable( GL_TEXTURE_2D );
-            } glPopMatrix();
+            } llce::gfx::state::modelview( mat4f32_t(1.0f) );
         }
 #endif
 
-        SDL_GL_SwapWindow( window );
+        if( cScaleDynamic && !hasGPUTimers && !cIsHeadless && !isFrameStatic ) {
+            glFinish();
+        }
+        const float64_t cFrameBusySecs = ( SDL_GetPerformanceCounter() - scaleStartTicks ) / cLatencyTickRate;
+        if( !cIsHeadless && !isFrameStatic ) {
+            SDL_GL_SwapWindow( window );
+        }
+
+        if( llce::gfx::timings(gpuPassSecs) ) {
+            scaleGPUSecs = 0.0;
+            for( uint32_t passIdx = 0; passIdx < llce::gfx::pass::_length; passIdx++ ) {
+                scaleGPUSecs += gpuPassSecs[passIdx];
+                gpuPassSums[passIdx] += gpuPassSecs[passIdx];
+#if LLCE_DEBUG
+                if( cShowMeta ) {
+                    metaState->gpuPassDTs[passIdx].push_back( gpuPassSecs[passIdx] );
+                }
+#endif
+            }
+            gpuCount++;
+        }
+
+        if( cMeasureLatency && doStep && !isReplaying ) {
+            if( cFenceLatency && !cIsHeadless ) {
+                glFinish();
+            }
+
+            const float64_t cSwapSecs = ( SDL_GetPerformanceCounter() - latencyReadTicks ) / cLatencyTickRate;
+            for( uint32_t edgeIdx = 0; edgeIdx < simInput->mEdgeCount; edgeIdx++ ) {
+                const llce::input::edge_t& cEdge = simInput->mEdges[edgeIdx];
+                if( cEdge.mDiff == llce::input::diff_e::down ) {
+                    const float64_t cLatencySecs = cEdge.mAge + cSwapSecs;
+                    latencyStream << simFrame << ",\"" << llce::input::identify( cEdge.mGID ) << "\"," <<
+                        1.0e3 * cEdge.mAge << "," << 1.0e3 * cSwapSecs << "," <<
+                        1.0e3 * cLatencySecs << "\n";
+                    latencyCount++;
+                    latencySum += cLatencySecs;
+#if LLCE_DEBUG
+                    if( cShowMeta ) {
+                        metaState->inputLatencies.push_back( cLatencySecs );
+                    }
+#endif
+                }
+            }
+        }
 
         const float32_t cFrameFPS = csSimFPS * std::pow( 2.0f, simSpeedFactor + 0.0f );
+        const bool32_t cIsFrameIdle = isFrameStatic && std::all_of(
+            &audioBuffer[0], &audioBuffer[LLCE_ELEM_COUNT(audioBuffer)],
+            [] (const int16_t pSample) { return pSample == 0; } );
         simTimer.split();
-        simWT = cIsSimulating ? 0.0 : simTimer.wait( cFrameFPS );
+        if( cIsFrameIdle ) {
+            // NOTE(JRC): Idle frames sleep through their slack in one wait instead of
+            // waking every sample period, so inputs that arrive within the frame are
+            // only pumped (and thus timestamped) once it ends, which is fine since
+            // nothing is moving.
+            simWT = simTimer.wait( cFrameFPS );
+        } else {
+            simWT = cIsSimulating ? 0.0 : simTimer.wait( llce::sampler_t::slice, &inputSampler,
+                llce::sampler_t::SAMPLE_PERIOD, cFrameFPS );
+        }
         simDT = simTimer.ft( llce::timer_t::time_e::ideal );
         simFrame++;
 
+        if( cScaleDynamic && !cIsFrameIdle ) {
+            scaleBusySum += std::max( cFrameBusySecs, scaleGPUSecs );
+            if( ++scaleFrameCount == csScaleWindow ) {
+                const float64_t cBusyRatio = cFrameFPS * scaleBusySum / csScaleWindow;
+                const uint32_t cScaleLevel =
+                    ( cBusyRatio > csScaleDownRatio && scaleLevel + 1 < csScaleLevelCount ) ? scaleLevel + 1 :
+                    ( cBusyRatio < csScaleUpRatio && scaleLevel > 0 ) ? scaleLevel - 1 : scaleLevel;
+                if( cScaleLevel != scaleLevel ) {
+                    LLCE_INFO_DEBUG( "Frame Scale {" << csScaleLevels[cScaleLevel] << "x, " <<
+                        100.0 * cBusyRatio << "% busy}" );
+                }
+
+                scaleLevel = cScaleLevel;
+                scaleFrameCount = 0;
+                scaleBusySum = 0.0;
+            }
+        }
+
         LLCE_ASSERT_WARNING( simWT >= 0.0 || simFrame == 0,
             "Frame {" << simFrame << "} lagged; achieved " <<
             1.0 / (simDT - simWT) << " fps for ideal " << csSimFPS << " fps!" );
@@ -960,6 +1290,22 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
 
     /// Clean Up + Exit ///
 
+    LLCE_INFO_DEBUG( "Frame Arena Peak {" << simArena.peak() << "/" << simArena.capacity() << " bytes}" );
+#if LLCE_CAPTURE
+    captureEncoder.report();
+#endif
+    LLCE_INFO_DEBUG( "Frame Command Peak {" << simListPeakCount << " commands, " <<
+        simList.mPeakLength << "/" << simList.mBufferLength << " bytes}" );
+    if( cMeasureLatency ) {
+        LLCE_INFO_RELEASE( "Input Latency {" << latencyCount << " samples, " <<
+            (latencyCount > 0 ? 1.0e3 * latencySum / latencyCount : 0.0) << " ms mean}" );
+        latencyStream.close();
+    }
+    for( uint32_t passIdx = 0; passIdx < llce::gfx::pass::_length && cMeasureGPU; passIdx++ ) {
+        LLCE_INFO_RELEASE( "GPU " << csGPUPassNames[passIdx] << " Time {" << gpuCount << " samples, " <<
+            (gpuCount > 0 ? 1.0e3 * gpuPassSums[passIdx] / gpuCount : 0.0) << " ms mean}" );
+    }
+
 #if LLCE_DYLOAD
     for( uint32_t dllIdx = 0; dllIdx < csDLLCount; dllIdx++ ) {
         if( dllHandles[dllIdx] != nullptr ) {
@@ -970,13 +1316,20 @@ int32_t main( const int32_t pArgCount, const char8_t* pArgs[] ) {
 
     recStateStream.close();
     recInputStream.close();
+    recBindingStream.close();
+
+#if LLCE_DEBUG
+    llce::platform::deallocMirror( backupInputBuffer, cBackupInputLength );
+#endif
 
     TTF_CloseFont( font );
     TTF_Quit();
 
     SDL_CloseAudioDevice( audioDeviceID );
 
-    SDL_GL_DeleteContext( windowGL );
+    if( windowGL != nullptr ) {
+        SDL_GL_DeleteContext( windowGL );
+    }
     SDL_DestroyWindow( window );
 
     SDL_Quit();
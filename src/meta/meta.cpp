@@ -2,6 +2,7 @@
 #include <SDL2/SDL_opengl.h>
 #include <SDL2/SDL_opengl_glext.h>
 
+#include <algorithm>
 #include <cstring>
 
 #include "input.h"
@@ -36,10 +37,14 @@ bool32_t init( meta::state_t* pState, meta::input_t* pInput ) {
 
     pState->frameDTs.clear();
     pState->audioSamples.clear();
+    pState->inputLatencies.clear();
+    for( uint32_t passIdx = 0; passIdx < llce::gfx::pass::_length; passIdx++ ) {
+        pState->gpuPassDTs[passIdx].clear();
+    }
 
     // Initialize Input //
 
-    std::memset( pInput, 0, sizeof(meta::input_t) );
+    std::memset( pInput, 0, meta::input_t::FRAME_BYTES );
 
     // Initialize Per-Mode Variables //
 
@@ -83,37 +88,127 @@ bool32_t render( const meta::state_t* pState, const meta::input_t* pInput, const
     const static float32_t csMetaUILineWidth = 5.0f;
     const static vec2f32_t csMetaUITargetPadding = { 0.0f, 0.25f };
 
-    { // Render Trend Line //
-        const static color4u8_t csMetaUITrendColor = { 0xff, 0x00, 0x00, 0xff };
-        const static uint16_t csMetaUITrendPattern = 0xffff;
-
-        llce::gfx::render_context_t trendLineRC(
-            llce::box_t(0.0f, 0.0f, 1.0f, 1.0f - csMetaUITargetPadding.y) );
-        llce::gfx::color_context_t trendLineCC( &csMetaUITrendColor );
-
-        glLineWidth( csMetaUILineWidth );
-        glLineStipple( 1, csMetaUITrendPattern );
-        glBegin( GL_LINE_STRIP ); {
-            for( uint32_t frameIdx = 0; frameIdx < pState->frameDTs.size(); frameIdx++ ) {
-                float64_t frameU = 1.0f - ( (frameIdx + 0.0f) / pState->frameDTs.capacity() );
-                float64_t frameV = ( 1.0 / pState->frameDTs.back(frameIdx) ) / LLCE_FPS;
-                glVertex2f( frameU, frameV );
+    if( pState->mode == meta::mode::fps ) {
+        { // Render Trend Line //
+            const static color4u8_t csMetaUITrendColor = { 0xff, 0x00, 0x00, 0xff };
+            const static uint16_t csMetaUITrendPattern = 0xffff;
+
+            llce::gfx::render_context_t trendLineRC(
+                llce::box_t(0.0f, 0.0f, 1.0f, 1.0f - csMetaUITargetPadding.y) );
+            llce::gfx::color_context_t trendLineCC( &csMetaUITrendColor );
+            llce::gfx::raw_context_t trendLineGLC;
+
+            glLineWidth( csMetaUILineWidth );
+            glLineStipple( 1, csMetaUITrendPattern );
+            glBegin( GL_LINE_STRIP ); {
+                for( uint32_t frameIdx = 0; frameIdx < pState->frameDTs.size(); frameIdx++ ) {
+                    float64_t frameU = 1.0f - ( (frameIdx + 0.0f) / pState->frameDTs.capacity() );
+                    float64_t frameV = ( 1.0 / pState->frameDTs.back(frameIdx) ) / LLCE_FPS;
+                    glVertex2f( frameU, frameV );
+                }
+            } glEnd();
+        }
+
+        { // Render UI Elements //
+            const static color4u8_t csMetaUITargetColor = { 0x00, 0x00, 0xff, 0xff };
+            const static uint16_t csMetaUITargetPattern = 0x00ff;
+
+            llce::gfx::color_context_t targetLineCC( &csMetaUITargetColor );
+            llce::gfx::raw_context_t targetLineGLC;
+
+            glLineWidth( csMetaUILineWidth );
+            glLineStipple( 1, csMetaUITargetPattern );
+            glBegin( GL_LINES ); {
+                glVertex2f( 0.0f - csMetaUITargetPadding.x, 1.0f - csMetaUITargetPadding.y );
+                glVertex2f( 1.0f + csMetaUITargetPadding.x, 1.0f - csMetaUITargetPadding.y );
+            } glEnd();
+        }
+    } else if( pState->mode == meta::mode::gpu ) {
+        { // Render Trend Lines //
+            const static color4u8_t csMetaUIPassColors[llce::gfx::pass::_length] = {
+                {0xff, 0x00, 0x00, 0xff}, {0x00, 0xa0, 0x00, 0xff}, {0xff, 0x80, 0x00, 0xff},
+                {0xa0, 0x00, 0xa0, 0xff}, {0x00, 0xa0, 0xa0, 0xff} };
+            const static uint16_t csMetaUITrendPattern = 0xffff;
+
+            llce::gfx::render_context_t trendLineRC(
+                llce::box_t(0.0f, 0.0f, 1.0f, 1.0f - csMetaUITargetPadding.y) );
+
+            // NOTE(JRC): Each pass is plotted as a fraction of the frame time budget,
+            // so a pass that reaches the target line consumes the whole frame.
+            for( uint32_t passIdx = 0; passIdx < llce::gfx::pass::_length; passIdx++ ) {
+                const auto& cPassDTs = pState->gpuPassDTs[passIdx];
+
+                llce::gfx::color_context_t trendLineCC( &csMetaUIPassColors[passIdx] );
+                llce::gfx::raw_context_t trendLineGLC;
+
+                glLineWidth( csMetaUILineWidth );
+                glLineStipple( 1, csMetaUITrendPattern );
+                glBegin( GL_LINE_STRIP ); {
+                    for( uint32_t frameIdx = 0; frameIdx < cPassDTs.size(); frameIdx++ ) {
+                        float64_t frameU = 1.0f - ( (frameIdx + 0.0f) / cPassDTs.capacity() );
+                        float64_t frameV = cPassDTs.back( frameIdx ) * LLCE_FPS;
+                        glVertex2f( frameU, frameV );
+                    }
+                } glEnd();
             }
-        } glEnd();
-    }
-
-    { // Render UI Elements //
-        const static color4u8_t csMetaUITargetColor = { 0x00, 0x00, 0xff, 0xff };
-        const static uint16_t csMetaUITargetPattern = 0x00ff;
-
-        llce::gfx::color_context_t targetLineCC( &csMetaUITargetColor );
-
-        glLineWidth( csMetaUILineWidth );
-        glLineStipple( 1, csMetaUITargetPattern );
-        glBegin( GL_LINES ); {
-            glVertex2f( 0.0f - csMetaUITargetPadding.x, 1.0f - csMetaUITargetPadding.y );
-            glVertex2f( 1.0f + csMetaUITargetPadding.x, 1.0f - csMetaUITargetPadding.y );
-        } glEnd();
+        }
+
+        { // Render UI Elements //
+            const static color4u8_t csMetaUITargetColor = { 0x00, 0x00, 0xff, 0xff };
+            const static uint16_t csMetaUITargetPattern = 0x00ff;
+
+            llce::gfx::color_context_t targetLineCC( &csMetaUITargetColor );
+            llce::gfx::raw_context_t targetLineGLC;
+
+            glLineWidth( csMetaUILineWidth );
+            glLineStipple( 1, csMetaUITargetPattern );
+            glBegin( GL_LINES ); {
+                glVertex2f( 0.0f - csMetaUITargetPadding.x, 1.0f - csMetaUITargetPadding.y );
+                glVertex2f( 1.0f + csMetaUITargetPadding.x, 1.0f - csMetaUITargetPadding.y );
+            } glEnd();
+        }
+    } else if( pState->mode == meta::mode::latency ) {
+        // NOTE(JRC): Latencies are binned at render time since the sample
+        // count is small and this keeps the state a simple history.
+        uint32_t latencyBins[meta::LATENCY_BIN_COUNT] = {};
+        for( const float64_t& latency : pState->inputLatencies ) {
+            const uint32_t cBinIdx = static_cast<uint32_t>( latency / meta::LATENCY_BIN_WIDTH );
+            latencyBins[std::min(cBinIdx, meta::LATENCY_BIN_COUNT - 1)]++;
+        }
+        const uint32_t cMaxBinCount = std::max( 1u,
+            *std::max_element(&latencyBins[0], &latencyBins[meta::LATENCY_BIN_COUNT]) );
+
+        { // Render Histogram Bars //
+            const static color4u8_t csMetaUIBinColor = { 0xff, 0x00, 0x00, 0xff };
+
+            llce::gfx::render_context_t binsRC(
+                llce::box_t(0.0f, 0.0f, 1.0f, 1.0f - csMetaUITargetPadding.y) );
+            llce::gfx::color_context_t binsCC( &csMetaUIBinColor );
+
+            for( uint32_t binIdx = 0; binIdx < meta::LATENCY_BIN_COUNT; binIdx++ ) {
+                float32_t binU = ( binIdx + 0.0f ) / meta::LATENCY_BIN_COUNT;
+                float32_t binW = 1.0f / meta::LATENCY_BIN_COUNT;
+                float32_t binV = ( latencyBins[binIdx] + 0.0f ) / cMaxBinCount;
+                llce::gfx::render::box( llce::box_t(binU, 0.0f, 0.9f * binW, binV) );
+            }
+        }
+
+        { // Render UI Elements //
+            const static color4u8_t csMetaUITargetColor = { 0x00, 0x00, 0xff, 0xff };
+            const static uint16_t csMetaUITargetPattern = 0x00ff;
+            const static float32_t csMetaUIFrameU = static_cast<float32_t>(
+                ( 1.0 / LLCE_FPS ) / ( meta::LATENCY_BIN_COUNT * meta::LATENCY_BIN_WIDTH ) );
+
+            llce::gfx::color_context_t targetLineCC( &csMetaUITargetColor );
+            llce::gfx::raw_context_t targetLineGLC;
+
+            glLineWidth( csMetaUILineWidth );
+            glLineStipple( 1, csMetaUITargetPattern );
+            glBegin( GL_LINES ); {
+                glVertex2f( csMetaUIFrameU, 0.0f );
+                glVertex2f( csMetaUIFrameU, 1.0f - csMetaUITargetPadding.y );
+            } glEnd();
+        }
     }
 
     return true;
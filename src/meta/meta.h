@@ -13,10 +13,13 @@ namespace meta {
 
 /// State Types/Variables ///
 
-LLCE_ENUM( mode, fps, audio );
+LLCE_ENUM( mode, fps, audio, latency, gpu );
 
 constexpr static uint32_t FPS_FRAME_COUNT = 2 * LLCE_FPS;
 constexpr static uint32_t AUDIO_SAMPLE_COUNT = 5 * LLCE_SPS * LLCE_MAX_CHANNELS;
+constexpr static uint32_t LATENCY_SAMPLE_COUNT = 4 * LLCE_FPS;
+constexpr static uint32_t LATENCY_BIN_COUNT = 50;
+constexpr static float64_t LATENCY_BIN_WIDTH = 2.0e-3;
 
 struct state_t {
     mode_e mode;
@@ -26,6 +29,16 @@ struct state_t {
 
     // Audio State //
     llce::deque<int16_t, meta::AUDIO_SAMPLE_COUNT> audioSamples;
+
+    // Latency State //
+    // NOTE(JRC): Input-to-photon latencies (in seconds) are supplied by the
+    // harness when latency instrumentation is enabled (see '-l' option).
+    llce::deque<float64_t, meta::LATENCY_SAMPLE_COUNT> inputLatencies;
+
+    // GPU State //
+    // NOTE(JRC): Per-pass GPU render times (in seconds) are supplied by the
+    // harness when GPU instrumentation is enabled (see '-g' option).
+    llce::deque<float64_t, meta::FPS_FRAME_COUNT> gpuPassDTs[llce::gfx::pass::_length];
 };
 
 /// Input/Output Types/Variables ///
@@ -24,9 +24,12 @@ ring_t calcRingAlloc( const uint64_t pOffset, const uint64_t pLength, const uint
 }
 
 
-buffer_t::buffer_t( bit8_t* pBuffer, const uint64_t pBufferCapacity ) {
+// NOTE(JRC): Mirrored buffers must be allocated with 'platform::allocMirror',
+// which allows all wraparound accesses to be performed with a single copy.
+buffer_t::buffer_t( bit8_t* pBuffer, const uint64_t pBufferCapacity, const bool32_t pIsMirrored ) {
     mBuffer = pBuffer;
     mBufferCapacity = pBufferCapacity;
+    mBufferMirrored = pIsMirrored;
 
     mBufferStart = 0;
     mBufferEnd = 0;
@@ -40,7 +43,10 @@ bool32_t buffer_t::enqueue( const bit8_t* pBuffer, const uint64_t pBufferLength
         "Couldn't enqueue additional memory at " << pBuffer << " of size " <<
         pBufferLength << "; insufficient buffer memory remaining." );
 
-    if( newBufferFits ) {
+    if( newBufferFits && mBufferMirrored ) {
+        std::memcpy( mBuffer + mBufferEnd, pBuffer, pBufferLength );
+        mBufferEnd = ( mBufferEnd + pBufferLength ) % mBufferCapacity;
+    } else if( newBufferFits ) {
         ring_t bufferAlloc = calcRingAlloc( mBufferEnd, pBufferLength, mBufferCapacity );
 
         std::memcpy( mBuffer + mBufferEnd, pBuffer + 0, bufferAlloc.regions[0] );
@@ -62,6 +68,7 @@ bool32_t buffer_t::clear() {
 }
 
 
+// NOTE(JRC): Dequeuing to a null buffer discards the data instead of copying it.
 bool32_t buffer_t::dequeue( bit8_t* pBuffer, const uint64_t pBufferLength ) {
     bool32_t hasEnoughData = pBufferLength <= this->length();
 
@@ -69,7 +76,12 @@ bool32_t buffer_t::dequeue( bit8_t* pBuffer, const uint64_t pBufferLength ) {
         "Couldn't dequeue requested memory to " << pBuffer << " of size " <<
         pBufferLength << "; insufficient buffer memory available." );
 
-    if( hasEnoughData ) {
+    if( hasEnoughData && pBuffer == nullptr ) {
+        mBufferStart = ( mBufferStart + pBufferLength ) % mBufferCapacity;
+    } else if( hasEnoughData && mBufferMirrored ) {
+        std::memcpy( pBuffer, mBuffer + mBufferStart, pBufferLength );
+        mBufferStart = ( mBufferStart + pBufferLength ) % mBufferCapacity;
+    } else if( hasEnoughData ) {
         ring_t bufferAlloc = calcRingAlloc( mBufferStart, pBufferLength, mBufferCapacity );
 
         std::memcpy( pBuffer + 0, mBuffer + mBufferStart, bufferAlloc.regions[0] );
@@ -82,6 +94,17 @@ bool32_t buffer_t::dequeue( bit8_t* pBuffer, const uint64_t pBufferLength ) {
 }
 
 
+// NOTE(JRC): All of the buffer's contents can be read contiguously from its
+// front only if it's mirrored; otherwise, they may wrap around its end.
+const bit8_t* buffer_t::front() const {
+    LLCE_CHECK_ERROR( mBufferMirrored,
+        "Cannot access the contents of buffer at " << (void*)mBuffer << " " <<
+        "contiguously; only mirrored buffers support contiguous access." );
+
+    return mBuffer + mBufferStart;
+}
+
+
 uint64_t buffer_t::length() const {
     return ( mBufferStart <= mBufferEnd ) ? mBufferEnd - mBufferStart :
         mBufferEnd + mBufferCapacity - mBufferStart;
@@ -10,7 +10,7 @@ class buffer_t {
 
     /// Constructors ///
 
-    buffer_t( bit8_t* pBuffer, const uint64_t pBufferCapacity );
+    buffer_t( bit8_t* pBuffer, const uint64_t pBufferCapacity, const bool32_t pIsMirrored = false );
 
     /// Class Functions ///
 
@@ -18,6 +18,8 @@ class buffer_t {
     bool32_t dequeue( bit8_t* pData = nullptr, const uint64_t pDataLength = 0 );
     bool32_t clear();
 
+    const bit8_t* front() const;
+
     uint64_t length() const;
     uint64_t capacity() const;
 
@@ -27,6 +29,7 @@ class buffer_t {
 
     bit8_t* mBuffer;
     uint64_t mBufferCapacity;
+    bool32_t mBufferMirrored;
 
     uint64_t mBufferStart;
     uint64_t mBufferEnd;
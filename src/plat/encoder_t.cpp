@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+
+#include "platform.h"
+
+#include "encoder_t.h"
+
+namespace llce {
+
+/// Helper Functions ///
+
+inline uint64_t frameLength( const uint64_t pPixelLength ) {
+    return sizeof( encoder_t::frame_t ) + pPixelLength + 4 * sizeof( size_t );
+}
+
+/// Class Functions ///
+
+// NOTE(JRC): Every frame is carved at the maximum frame length regardless of its
+// actual dimensions so that all released runs can be reused by any later frame,
+// which guarantees that a carve succeeds whenever fewer than 'MAX_PENDING' frames
+// are outstanding.
+encoder_t::encoder_t( const uint64_t pFrameLength, const uint32_t pBufferFlags ) :
+        mFramePool( MAX_PENDING * (frameLength(pFrameLength) + pool_t::DEFAULT_PAGE_LENGTH),
+            nullptr, pBufferFlags ),
+        mFrameLength( pFrameLength ), mFramesPending( 0 ),
+        mFrameQueue( &mFrameBuffer[0], sizeof(mFrameBuffer) ),
+        mIsStopping( false ) {
+    mThread = std::thread( &encoder_t::work, this );
+}
+
+
+encoder_t::~encoder_t() {
+    {
+        std::lock_guard<std::mutex> wakeLock( mWakeMutex );
+        mIsStopping = true;
+    }
+    mWakeCondition.notify_all();
+
+    mThread.join();
+}
+
+
+encoder_t::frame_t* encoder_t::reserve( const char8_t* pPath, const uint64_t pIndex ) {
+    {
+        std::unique_lock<std::mutex> wakeLock( mWakeMutex );
+        mWakeCondition.wait( wakeLock, [this] () {
+            return mFramesPending.load(std::memory_order_acquire) < MAX_PENDING; } );
+    }
+    mFramesPending.fetch_add( 1, std::memory_order_relaxed );
+
+    memory_t* frameArena = mFramePool.carve( frameLength(mFrameLength), frameLength(mFrameLength) );
+    LLCE_CHECK_ERROR( frameArena != nullptr,
+        "Unable to reserve capture frame {" << pIndex << "}; " <<
+        "the encoder's frame pool is exhausted." );
+
+    frame_t* frame = (frame_t*)frameArena->dalloc( sizeof(frame_t) );
+    std::snprintf( &frame->mPath[0], sizeof(frame->mPath), "%s", pPath );
+    frame->mIndex = pIndex;
+    frame->mWidth = 0;
+    frame->mHeight = 0;
+    frame->mPixels = frameArena->dalloc( mFrameLength );
+    frame->mArena = frameArena;
+
+    return frame;
+}
+
+
+// NOTE(JRC): The pixels of a submitted frame should be stored bottom row first
+// (i.e. in the order produced by OpenGL readbacks); they're flipped for encoding.
+void encoder_t::submit( frame_t* pFrame ) {
+    LLCE_CHECK_ERROR( (uint64_t)pFrame->mWidth * pFrame->mHeight * PIXEL_LENGTH <= mFrameLength,
+        "Unable to submit capture frame {" << pFrame->mIndex << "} of size " <<
+        pFrame->mWidth << "x" << pFrame->mHeight << "; frame exceeds the maximum " <<
+        "frame length of " << mFrameLength << " bytes." );
+
+    {
+        std::lock_guard<std::mutex> wakeLock( mWakeMutex );
+        mFrameQueue.enqueue( (const bit8_t*)&pFrame, sizeof(frame_t*) );
+    }
+    mWakeCondition.notify_all();
+}
+
+
+void encoder_t::work() {
+    while( true ) {
+        bool32_t isStopping = false;
+        {
+            std::unique_lock<std::mutex> wakeLock( mWakeMutex );
+            mWakeCondition.wait( wakeLock, [this] () {
+                return mIsStopping || mFrameQueue.length() != 0; } );
+            isStopping = mIsStopping;
+        }
+
+        for( frame_t* frame = nullptr; mFrameQueue.length() != 0; ) {
+            mFrameQueue.dequeue( (bit8_t*)&frame, sizeof(frame_t*) );
+            encode( frame );
+
+            mFramePool.release( frame->mArena );
+            {
+                std::lock_guard<std::mutex> wakeLock( mWakeMutex );
+                mFramesPending.fetch_sub( 1, std::memory_order_release );
+            }
+            mWakeCondition.notify_all();
+        }
+
+        if( isStopping ) {
+            return;
+        }
+    }
+}
+
+
+// TODO(JRC): Ultimately, it would be best if the data could just be funneled
+// natively into the PNG interface instead of having to mirror it about the
+// y=h/2 axis.
+void encoder_t::encode( frame_t* pFrame ) {
+    const uint64_t cRowLength = pFrame->mWidth * PIXEL_LENGTH;
+    bit8_t swapBuffer[1 << 10];
+    for( uint32_t rowIdx = 0; rowIdx < pFrame->mHeight / 2; rowIdx++ ) {
+        bit8_t* row = pFrame->mPixels + rowIdx * cRowLength;
+        bit8_t* opp = pFrame->mPixels + ( pFrame->mHeight - rowIdx - 1 ) * cRowLength;
+        for( uint64_t swapOff = 0; swapOff < cRowLength; swapOff += sizeof(swapBuffer) ) {
+            const uint64_t cSwapLength = std::min<uint64_t>( sizeof(swapBuffer), cRowLength - swapOff );
+            std::memcpy( &swapBuffer[0], row + swapOff, cSwapLength );
+            std::memcpy( row + swapOff, opp + swapOff, cSwapLength );
+            std::memcpy( opp + swapOff, &swapBuffer[0], cSwapLength );
+        }
+    }
+
+    LLCE_VERIFY_WARNING(
+        platform::pngSave(&pFrame->mPath[0], pFrame->mPixels, pFrame->mWidth, pFrame->mHeight),
+        "Failed to capture frame {" << pFrame->mIndex << "} to path '" << &pFrame->mPath[0] << "'." );
+}
+
+}
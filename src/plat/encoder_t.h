@@ -0,0 +1,81 @@
+#ifndef LLCE_ENCODER_T_H
+#define LLCE_ENCODER_T_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "pool_t.h"
+#include "queue_t.h"
+#include "memory_t.h"
+#include "consts.h"
+
+// NOTE(JRC): The encoder saves captured frames as images on a dedicated worker
+// thread so that encoding doesn't stall the frame loop. Each pending frame lives
+// in its own sub-arena carved from a memory pool; the frame loop carves and fills
+// these sub-arenas and the worker releases them once they're encoded, so the pool
+// is shared between both threads. Filled frames are passed to the worker through
+// a single-producer/single-consumer queue, and the frame loop only ever blocks if
+// it gets 'MAX_PENDING' frames ahead of the worker.
+
+namespace llce {
+
+class encoder_t {
+    public:
+
+    /// Class Attributes ///
+
+    const static uint32_t MAX_PENDING = 4;
+    const static uint32_t MAX_PATH_LENGTH = 256;
+    const static uint32_t PIXEL_LENGTH = 4; // RGBA, 8 bits per channel
+
+    /// Class Setup ///
+
+    struct frame_t {
+        char8_t mPath[MAX_PATH_LENGTH];
+        uint64_t mIndex;
+        uint32_t mWidth;
+        uint32_t mHeight;
+        bit8_t* mPixels;
+        memory_t* mArena;
+    };
+
+    /// Constructors ///
+
+    encoder_t( const uint64_t pFrameLength, const uint32_t pBufferFlags = platform::alloc::none );
+    ~encoder_t();
+
+    /// Class Functions ///
+
+    frame_t* reserve( const char8_t* pPath, const uint64_t pIndex );
+    void submit( frame_t* pFrame );
+
+    inline void report() const { mFramePool.report(); }
+
+    private:
+
+    /// Class Functions ///
+
+    void work();
+    void encode( frame_t* pFrame );
+
+    /// Class Fields ///
+
+    pool_t mFramePool;
+    uint64_t mFrameLength;
+    std::atomic<uint32_t> mFramesPending;
+
+    alignas(queue_t::CACHE_LINE_LENGTH) bit8_t mFrameBuffer[MAX_PENDING * sizeof(frame_t*)];
+    queue_t mFrameQueue;
+
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    bool32_t mIsStopping;
+
+    std::thread mThread;
+};
+
+}
+
+#endif
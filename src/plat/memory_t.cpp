@@ -15,8 +15,8 @@ inline uint64_t walign( uint64_t pBaseLength, uint64_t pHeaderLength ) {
 
 /// Class Functions ///
 
-memory_t::memory_t( uint64_t pBufferLength, uint64_t pDataLength, bit8_t* pBufferBase ) :
-        mBuffer( nullptr ), mBufferLength( pBufferLength ),
+memory_t::memory_t( uint64_t pBufferLength, uint64_t pDataLength, bit8_t* pBufferBase, uint32_t pBufferFlags ) :
+        mBuffer( nullptr ), mBufferLength( platform::allocLength(pBufferLength, pBufferFlags) ), mBufferFile( -1 ), mBufferOwned( true ),
         mData( nullptr ), mDataLength( pDataLength ),
         mHeap( nullptr ), mStack( nullptr ) {
     LLCE_CHECK_ERROR( pDataLength <= pBufferLength,
@@ -24,11 +24,31 @@ memory_t::memory_t( uint64_t pBufferLength, uint64_t pDataLength, bit8_t* pBuffe
         "data segment length " << pDataLength << " exceeds " <<
         "total buffer length " << pBufferLength << "." );
 
-    mBuffer = platform::allocBuffer( mBufferLength, pBufferBase );
+    LLCE_CHECK_WARNING( !(pBufferFlags & platform::alloc::snapshot) || !(pBufferFlags & platform::alloc::lock),
+        "Snapshot buffers can't be reverted while locked in memory; " <<
+        "locking will prevent snapshots from being restored." );
+
+    if( pBufferFlags & platform::alloc::snapshot ) {
+        mBufferFile = platform::allocFile( mBufferLength );
+    }
+
+    mBuffer = platform::allocBuffer( mBufferLength, pBufferBase, pBufferFlags, mBufferFile );
     LLCE_CHECK_ERROR( mBuffer != nullptr,
         "Unable to allocate buffer of length " << mBufferLength << " " <<
         "at base address " << pBufferBase << "." );
 
+#if LLCE_DEBUG
+    // NOTE(JRC): A freshly allocated snapshot buffer should have no private pages;
+    // if it does, every commit and revert will copy far more than was written.
+    if( mBufferFile >= 0 ) {
+        uint64_t commitCount = 0;
+        bool32_t commitSuccess = platform::commitBuffer( mBuffer, mBufferLength, mBufferFile, &commitCount );
+        LLCE_CHECK_WARNING( commitSuccess && commitCount == 0,
+            "Initial commit of snapshot buffer of length " << mBufferLength << " " <<
+            "wrote " << commitCount << " page(s); expected an empty commit." );
+    }
+#endif
+
     // TODO(JRC): Should attempt to word-align at this point to prevent bad
     // alignment for all data accesses.
     mData = mBuffer;
@@ -37,8 +57,48 @@ memory_t::memory_t( uint64_t pBufferLength, uint64_t pDataLength, bit8_t* pBuffe
 }
 
 
+// NOTE(JRC): This constructor creates a view over memory owned by another
+// object (e.g. a sub-arena carved from a 'pool_t'), so the buffer isn't
+// released when this object is destroyed.
+memory_t::memory_t( bit8_t* pBuffer, uint64_t pBufferLength, uint64_t pDataLength ) :
+        mBuffer( pBuffer ), mBufferLength( pBufferLength ), mBufferFile( -1 ), mBufferOwned( false ),
+        mData( pBuffer ), mDataLength( pDataLength ),
+        mHeap( pBuffer + pDataLength ), mStack( pBuffer + pBufferLength ) {
+    LLCE_CHECK_ERROR( pDataLength <= pBufferLength,
+        "Unable to generate a sensible memory buffer; " <<
+        "data segment length " << pDataLength << " exceeds " <<
+        "total buffer length " << pBufferLength << "." );
+}
+
+
 memory_t::~memory_t() {
-    platform::deallocBuffer( mBuffer, mBufferLength );
+    if( mBufferOwned ) {
+        platform::deallocBuffer( mBuffer, mBufferLength );
+    }
+    if( mBufferFile >= 0 ) {
+        platform::deallocFile( mBufferFile );
+    }
+}
+
+
+// NOTE(JRC): Snapshots only capture the contents of the buffer, so any
+// allocations made between a commit and a revert must be considered invalid
+// after the revert (the allocation bookkeeping itself isn't rolled back).
+bool32_t memory_t::commit() {
+    LLCE_CHECK_ERROR( mBufferFile >= 0,
+        "Cannot commit a snapshot of memory buffer at " << (void*)mBuffer << "; " <<
+        "this buffer wasn't allocated with snapshot support." );
+
+    return platform::commitBuffer( mBuffer, mBufferLength, mBufferFile );
+}
+
+
+bool32_t memory_t::revert() {
+    LLCE_CHECK_ERROR( mBufferFile >= 0,
+        "Cannot revert to a snapshot of memory buffer at " << (void*)mBuffer << "; " <<
+        "this buffer wasn't allocated with snapshot support." );
+
+    return platform::revertBuffer( mBuffer, mBufferLength );
 }
 
 
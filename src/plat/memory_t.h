@@ -3,6 +3,7 @@
 
 #include <limits>
 
+#include "platform.h"
 #include "consts.h"
 
 namespace llce {
@@ -24,7 +25,9 @@ class memory_t {
 
     /// Constructors ///
 
-    memory_t( uint64_t pBufferLength, uint64_t pDataLength, bit8_t* pBufferBase = nullptr );
+    memory_t( uint64_t pBufferLength, uint64_t pDataLength, bit8_t* pBufferBase = nullptr,
+        uint32_t pBufferFlags = platform::alloc::none );
+    memory_t( bit8_t* pBuffer, uint64_t pBufferLength, uint64_t pDataLength );
     ~memory_t();
 
     /// Class Functions ///
@@ -38,15 +41,24 @@ class memory_t {
     bit8_t* halloc( uint64_t pAllocLength );
     void hfree( bit8_t* pAllocBlock );
 
+    bool32_t commit();
+    bool32_t revert();
+
     inline bit8_t* buffer() const { return mBuffer; }
     inline uint64_t length() const { return mBufferLength; }
 
+    inline uint64_t dused() const { return mData - mBuffer; }
+    inline uint64_t hused() const { return mHeap - ( mBuffer + mDataLength ); }
+    inline uint64_t sused() const { return ( mBuffer + mBufferLength ) - mStack; }
+
     private:
 
     /// Class Fields ///
 
     bit8_t* mBuffer;
     uint64_t mBufferLength;
+    int32_t mBufferFile;
+    bool32_t mBufferOwned;
 
     bit8_t* mData;
     uint64_t mDataLength;
@@ -1,6 +1,8 @@
 #include <string.h>
 #include <stdio.h>
 
+#include <algorithm>
+
 #include <errno.h>
 #include <unistd.h>
 #include <dlfcn.h>
@@ -19,41 +21,122 @@ namespace llce {
 // NOTE(JRC): Documentation on the buffer allocation functions on Linux can be
 // found here: http://man7.org/linux/man-pages/man2/mmap.2.html
 
-bit8_t* platform::allocBuffer( uint64_t pBufferLength, bit8_t* pBufferBase ) {
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+// NOTE(JRC): The explicit huge page size is a property of the running system
+// (e.g. 2MB on most x86-64 configurations), so it's read from the kernel's
+// memory report and cached on first use.
+inline uint64_t hugePageLength() {
+    static uint64_t sHugePageLength = 0;
+
+    if( sHugePageLength == 0 ) {
+        FILE* meminfoFile = fopen( "/proc/meminfo", "r" );
+        char8_t meminfoLine[128];
+        uint64_t meminfoValue = 0;
+        while( meminfoFile != nullptr && fgets(&meminfoLine[0], sizeof(meminfoLine), meminfoFile) != nullptr ) {
+            if( sscanf(&meminfoLine[0], "Hugepagesize: %lu kB", &meminfoValue) == 1 ) {
+                sHugePageLength = meminfoValue * 1024;
+            }
+        } if( meminfoFile != nullptr ) {
+            fclose( meminfoFile );
+        }
+
+        sHugePageLength = ( sHugePageLength != 0 ) ? sHugePageLength : 2 * 1024 * 1024;
+    }
+
+    return sHugePageLength;
+}
+
+
+bit8_t* platform::allocBuffer( uint64_t pBufferLength, bit8_t* pBufferBase, uint32_t pBufferFlags, int32_t pBufferFile ) {
+    const bool32_t cIsFileBacked = pBufferFile >= 0;
     const int64_t cPermissionFlags = PROT_READ | PROT_WRITE;
-    const int64_t cAllocFlags = MAP_ANONYMOUS | MAP_PRIVATE |
-        ( (pBufferBase != nullptr) ? MAP_FIXED : 0 );
-
-    // TODO(JRC): This whole piece is a bit messy and prone to race conditions
-    // and thus should be cleaned up if possible.
-    if( cAllocFlags & MAP_FIXED ) {
-        const int64_t cPageSize = sysconf( _SC_PAGESIZE );
-        uchar8_t mincoreBuffer = false;
-
-        bool32_t isBufferOccupied = false;
-        for( bit8_t* pageIt = pBufferBase; pageIt < pBufferBase + pBufferLength; pageIt += cPageSize ) {
-            isBufferOccupied |= !(
-                mincore( pageIt, cPageSize, &mincoreBuffer ) == -1 &&
-                errno == ENOMEM );
+    // NOTE(JRC): Populating a writable private file mapping write-faults every
+    // page into a private copy, which would make every page of a snapshot buffer
+    // look touched on its first commit, so these buffers are prefaulted below.
+    const int64_t cAllocFlags = ( !cIsFileBacked ? MAP_ANONYMOUS : 0 ) | MAP_PRIVATE |
+        ( (pBufferBase != nullptr) ? MAP_FIXED_NOREPLACE : 0 ) |
+        ( ((pBufferFlags & alloc::prefault) && !cIsFileBacked) ? MAP_POPULATE : 0 );
+
+    LLCE_CHECK_ERROR( !(pBufferFlags & alloc::hugepage) || pBufferLength % hugePageLength() == 0,
+        "Unable to allocate huge page buffer of length " << pBufferLength << "; " <<
+        "length must be a multiple of the huge page length " << hugePageLength() << "." );
+
+    // NOTE(JRC): File-backed buffers are always mapped with base pages (see
+    // 'allocFile'), so only anonymous buffers try for explicit huge pages here;
+    // all other huge page buffers fall back to transparent huge pages below.
+    bit8_t* buffer = (bit8_t*)MAP_FAILED;
+    if( (pBufferFlags & alloc::hugepage) && !cIsFileBacked ) {
+        buffer = (bit8_t*)mmap(
+            pBufferBase,             // Memory Start Address
+            pBufferLength,           // Allocation Length (Bytes)
+            cPermissionFlags,        // Data Permission Flags (Read/Write)
+            cAllocFlags | MAP_HUGETLB, // Map Options (In-Memory, Private to Process, Huge Pages)
+            -1,                      // File Descriptor
+            0 );                     // File Offset
+
+        // NOTE(JRC): Explicit huge pages are only available if the system has
+        // reserved them ahead of time (e.g. via 'vm.nr_hugepages'), so their
+        // absence is treated as a soft failure that falls back on transparent pages.
+        LLCE_CHECK_WARNING( buffer != (bit8_t*)MAP_FAILED,
+            "Unable to allocate explicit huge page buffer of length " << pBufferLength << "; " <<
+            strerror(errno) << "; falling back to transparent huge pages." );
+    } if( buffer == (bit8_t*)MAP_FAILED ) {
+        buffer = (bit8_t*)mmap(
+            pBufferBase,             // Memory Start Address
+            pBufferLength,           // Allocation Length (Bytes)
+            cPermissionFlags,        // Data Permission Flags (Read/Write)
+            cAllocFlags,             // Map Options (In-Memory, Private to Process)
+            pBufferFile,             // File Descriptor
+            0 );                     // File Offset
+
+        if( buffer != (bit8_t*)MAP_FAILED && (pBufferFlags & alloc::hugepage) ) {
+            LLCE_VERIFY_WARNING( madvise(buffer, pBufferLength, MADV_HUGEPAGE) == 0,
+                "Unable to advise transparent huge pages for buffer of length " <<
+                pBufferLength << "; " << strerror(errno) );
         }
+    }
+
+    LLCE_CHECK_ERROR( buffer != (bit8_t*)MAP_FAILED,
+        "Unable to allocate buffer of length " << pBufferLength << " " <<
+        "at base address " << (void*)pBufferBase << "; " << strerror(errno) );
+    if( buffer == (bit8_t*)MAP_FAILED ) {
+        return nullptr;
+    }
 
-        LLCE_CHECK_ERROR( !isBufferOccupied,
+    // NOTE(JRC): Kernels older than 4.17 don't recognize 'MAP_FIXED_NOREPLACE'
+    // and treat the base address as a hint, so the returned address must be
+    // checked to ensure that the requested placement was honored.
+    if( pBufferBase != nullptr && buffer != pBufferBase ) {
+        munmap( buffer, pBufferLength );
+        LLCE_CHECK_ERROR( false,
             "Allocation of buffer of length " << pBufferLength << " " <<
-            "at base address " << pBufferBase << " will cause eviction of one "
+            "at base address " << (void*)pBufferBase << " would cause eviction of one " <<
             "or more existing memory blocks." );
+        return nullptr;
     }
 
-    bit8_t* buffer = (bit8_t*)mmap(
-        pBufferBase,             // Memory Start Address
-        pBufferLength,           // Allocation Length (Bytes)
-        cPermissionFlags,        // Data Permission Flags (Read/Write)
-        cAllocFlags,             // Map Options (In-Memory, Private to Process)
-        -1,                      // File Descriptor
-        0 );                     // File Offset
+    // NOTE(JRC): Read faults on a private file mapping share the file's pages
+    // instead of copying them, so file-backed buffers are prefaulted by reading
+    // a byte from each page after hinting the kernel to load the whole file.
+    if( (pBufferFlags & alloc::prefault) && cIsFileBacked ) {
+        LLCE_VERIFY_WARNING( madvise(buffer, pBufferLength, MADV_WILLNEED) == 0,
+            "Unable to prefault file-backed buffer of length " << pBufferLength << "; " <<
+            strerror(errno) );
+
+        const uint64_t cPageLength = sysconf( _SC_PAGESIZE );
+        for( uint64_t pageOffset = 0; pageOffset < pBufferLength; pageOffset += cPageLength ) {
+            (void)*(volatile bit8_t*)( buffer + pageOffset );
+        }
+    }
 
-    LLCE_CHECK_ERROR( buffer != (bit8_t*)MAP_FAILED,
-        "Unable to allocate buffer of length " << pBufferLength << " " <<
-        "at base address " << pBufferBase << "; " << strerror(errno) );
+    if( pBufferFlags & alloc::lock ) {
+        LLCE_VERIFY_WARNING( mlock(buffer, pBufferLength) == 0,
+            "Unable to lock buffer of length " << pBufferLength << " " <<
+            "into memory; " << strerror(errno) << " (see 'ulimit -l')." );
+    }
 
     return buffer;
 }
@@ -69,6 +152,175 @@ bool32_t platform::deallocBuffer( bit8_t* pBuffer, uint64_t pBufferLength ) {
     return status == 0;
 }
 
+
+uint64_t platform::allocLength( uint64_t pBufferLength, uint32_t pBufferFlags ) {
+    const uint64_t cPageLength = ( pBufferFlags & alloc::hugepage ) ?
+        hugePageLength() : static_cast<uint64_t>( sysconf(_SC_PAGESIZE) );
+    return cPageLength * ( (pBufferLength + cPageLength - 1) / cPageLength );
+}
+
+// NOTE(JRC): Mirror buffers map the same memory file twice back to back so that
+// any access that runs off the end of the first mapping continues seamlessly
+// into the start of the buffer. This lets ring buffers treat all wraparound
+// ranges as single contiguous regions. Since both halves alias the same pages,
+// the returned buffer spans twice the given length in virtual memory.
+
+bit8_t* platform::allocMirror( uint64_t pBufferLength, bit8_t* pBufferBase ) {
+    const uint64_t cPageLength = sysconf( _SC_PAGESIZE );
+    LLCE_CHECK_ERROR( pBufferLength % cPageLength == 0,
+        "Unable to allocate mirror buffer of length " << pBufferLength << "; " <<
+        "length must be a multiple of the page length " << cPageLength << "." );
+
+    int32_t bufferFile = allocFile( pBufferLength );
+    if( bufferFile < 0 ) {
+        return nullptr;
+    }
+
+    // NOTE(JRC): The full address range is reserved up front so that the two
+    // fixed mappings can't clobber any other allocations.
+    bit8_t* buffer = (bit8_t*)mmap( pBufferBase, 2 * pBufferLength, PROT_NONE,
+        MAP_ANONYMOUS | MAP_PRIVATE | ((pBufferBase != nullptr) ? MAP_FIXED_NOREPLACE : 0), -1, 0 );
+    bool32_t mirrorSuccess = buffer != (bit8_t*)MAP_FAILED &&
+        ( pBufferBase == nullptr || buffer == pBufferBase );
+
+    for( uint32_t mirrorIdx = 0; mirrorIdx < 2 && mirrorSuccess; mirrorIdx++ ) {
+        bit8_t* mirror = (bit8_t*)mmap( buffer + mirrorIdx * pBufferLength, pBufferLength,
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, bufferFile, 0 );
+        mirrorSuccess &= mirror == buffer + mirrorIdx * pBufferLength;
+    }
+
+    LLCE_CHECK_ERROR( mirrorSuccess,
+        "Unable to allocate mirror buffer of length " << pBufferLength << " " <<
+        "at base address " << (void*)pBufferBase << "; " << strerror(errno) );
+
+#if LLCE_DEBUG
+    if( mirrorSuccess ) {
+        volatile bit8_t* mirrorBuffer = buffer;
+        mirrorBuffer[pBufferLength - 1] = 1;
+        LLCE_CHECK_ERROR( mirrorBuffer[2 * pBufferLength - 1] == 1,
+            "Mirror buffer of length " << pBufferLength << " at base address " <<
+            (void*)buffer << " doesn't alias its two halves; wraparound access will fail." );
+        mirrorBuffer[pBufferLength - 1] = 0;
+    }
+#endif
+    if( !mirrorSuccess && buffer != (bit8_t*)MAP_FAILED ) {
+        munmap( buffer, 2 * pBufferLength );
+    }
+
+    // NOTE(JRC): The mappings retain their own references to the memory file,
+    // so its descriptor is no longer needed once they're established.
+    deallocFile( bufferFile );
+
+    return mirrorSuccess ? buffer : nullptr;
+}
+
+
+bool32_t platform::deallocMirror( bit8_t* pBuffer, uint64_t pBufferLength ) {
+    return deallocBuffer( pBuffer, 2 * pBufferLength );
+}
+
+// NOTE(JRC): Snapshot buffers are private (i.e. copy-on-write) mappings of an
+// in-memory file, which acts as the buffer's last committed state. Pages written
+// after a commit are privately copied by the kernel, so a commit only needs to
+// flush those pages to the file and a revert only needs to discard them. See
+// here for details: http://man7.org/linux/man-pages/man2/memfd_create.2.html
+//
+// Memory files are always backed by base pages since explicit huge page files
+// (i.e. 'MFD_HUGETLB') don't support 'pwrite' and would be copied and committed
+// in whole huge pages; huge page buffers use transparent pages instead (see
+// 'allocBuffer'), which the kernel still tracks with base page granularity.
+
+int32_t platform::allocFile( uint64_t pFileLength ) {
+    int32_t file = memfd_create( "llce", MFD_CLOEXEC );
+
+    LLCE_CHECK_ERROR( file >= 0,
+        "Unable to create memory file of length " << pFileLength << "; " << strerror(errno) );
+    if( file >= 0 && ftruncate(file, pFileLength) != 0 ) {
+        LLCE_CHECK_ERROR( false,
+            "Unable to resize memory file to length " << pFileLength << "; " << strerror(errno) );
+        close( file );
+        file = -1;
+    }
+
+    return file;
+}
+
+
+bool32_t platform::deallocFile( int32_t pFile ) {
+    int64_t status = close( pFile );
+
+    LLCE_CHECK_ERROR( status == 0,
+        "Deallocation of memory file " << pFile << " failed; " << strerror(errno) );
+
+    return status == 0;
+}
+
+
+bool32_t platform::commitBuffer( bit8_t* pBuffer, uint64_t pBufferLength, int32_t pBufferFile, uint64_t* pCommitCount ) {
+    const static uint64_t csPageMapPresent = 1ull << 63, csPageMapSwapped = 1ull << 62;
+    const static uint64_t csPageMapShared = 1ull << 61;
+    const static uint64_t csPageMapBatchCount = 512;
+
+    // NOTE(JRC): The page map has one entry per base page regardless of the page
+    // size of the mapping, and memory files are only ever mapped with base pages
+    // (see 'allocFile'), so pages are both scanned and committed at this size.
+    const uint64_t cPageLength = sysconf( _SC_PAGESIZE );
+    const uint64_t cPageCount = pBufferLength / cPageLength;
+
+    bool32_t commitSuccess = true;
+    uint64_t commitCount = 0;
+
+    // NOTE(JRC): A page is considered touched (i.e. privately copied) if it's
+    // resident or swapped but no longer shared with the backing file. If the
+    // page map is unavailable, all pages are conservatively treated as touched.
+    // See here for details: https://www.kernel.org/doc/Documentation/vm/pagemap.txt
+    FILE* pageMapFile = fopen( "/proc/self/pagemap", "rb" );
+    uint64_t pageMapEntries[csPageMapBatchCount];
+    for( uint64_t pageIdx = 0; pageIdx < cPageCount && commitSuccess; pageIdx += csPageMapBatchCount ) {
+        const uint64_t cBatchCount = std::min( csPageMapBatchCount, cPageCount - pageIdx );
+        const uint64_t cBatchOffset = ( (uint64_t)pBuffer / cPageLength + pageIdx ) * sizeof( uint64_t );
+
+        bool32_t isPageMapValid = pageMapFile != nullptr &&
+            fseek( pageMapFile, cBatchOffset, SEEK_SET ) == 0 &&
+            fread( &pageMapEntries[0], sizeof(uint64_t), cBatchCount, pageMapFile ) == cBatchCount;
+        for( uint64_t batchIdx = 0; batchIdx < cBatchCount && commitSuccess; batchIdx++ ) {
+            const uint64_t cPageEntry = pageMapEntries[batchIdx];
+            const bool32_t cIsPageTouched = !isPageMapValid ||
+                ( (cPageEntry & (csPageMapPresent | csPageMapSwapped)) && !(cPageEntry & csPageMapShared) );
+            if( cIsPageTouched ) {
+                const uint64_t cPageOffset = ( pageIdx + batchIdx ) * cPageLength;
+                commitSuccess &= pwrite( pBufferFile, pBuffer + cPageOffset,
+                    cPageLength, cPageOffset ) == (int64_t)cPageLength;
+                commitCount++;
+            }
+        }
+    }
+    if( pageMapFile != nullptr ) {
+        fclose( pageMapFile );
+    }
+
+    LLCE_CHECK_ERROR( commitSuccess,
+        "Unable to commit buffer of length " << pBufferLength << " " <<
+        "at base address " << (void*)pBuffer << "; " << strerror(errno) );
+
+    if( pCommitCount != nullptr ) {
+        *pCommitCount = commitCount;
+    }
+
+    return commitSuccess && revertBuffer( pBuffer, pBufferLength );
+}
+
+
+bool32_t platform::revertBuffer( bit8_t* pBuffer, uint64_t pBufferLength ) {
+    int64_t status = madvise( pBuffer, pBufferLength, MADV_DONTNEED );
+
+    LLCE_CHECK_ERROR( status == 0,
+        "Unable to revert buffer of length " << pBufferLength << " " <<
+        "at base address " << (void*)pBuffer << "; " << strerror(errno) );
+
+    return status == 0;
+}
+
 // NOTE(JRC): Documentation on Linux's dynamic-library loading functions can be
 // found here: http://man7.org/linux/man-pages/man3/dlmopen.3.html
 
@@ -7,10 +7,34 @@
 namespace llce {
 
 namespace platform {
+    /// Namespace Types ///
+
+    // NOTE(JRC): These flags are combined bitwise to control the allocation
+    // policies used for a particular buffer (see 'allocBuffer' for details).
+    namespace alloc { enum alloc_e : uint32_t {
+        none = 0,
+        hugepage = 1 << 0, // back w/ explicit huge pages (fallback: transparent)
+        prefault = 1 << 1, // fault in all pages at allocation time
+        lock = 1 << 2,     // lock all pages into physical memory
+        snapshot = 1 << 3  // back w/ memory file to support copy-on-write snapshots (huge pages: transparent only)
+    }; };
+    typedef alloc::alloc_e alloc_e;
+
     /// Namespace Functions ///
 
-    bit8_t* allocBuffer( uint64_t pBufferLength, bit8_t* pBufferStart = nullptr );
+    bit8_t* allocBuffer( uint64_t pBufferLength, bit8_t* pBufferStart = nullptr,
+        uint32_t pBufferFlags = alloc::none, int32_t pBufferFile = -1 );
     bool32_t deallocBuffer( bit8_t* pBuffer, uint64_t pBufferLength );
+    uint64_t allocLength( uint64_t pBufferLength, uint32_t pBufferFlags = alloc::none );
+
+    bit8_t* allocMirror( uint64_t pBufferLength, bit8_t* pBufferStart = nullptr );
+    bool32_t deallocMirror( bit8_t* pBuffer, uint64_t pBufferLength );
+
+    int32_t allocFile( uint64_t pFileLength );
+    bool32_t deallocFile( int32_t pFile );
+
+    bool32_t commitBuffer( bit8_t* pBuffer, uint64_t pBufferLength, int32_t pBufferFile, uint64_t* pCommitCount = nullptr );
+    bool32_t revertBuffer( bit8_t* pBuffer, uint64_t pBufferLength );
 
     void* dllLoadHandle( const char8_t* pDLLPath );
     bool32_t dllUnloadHandle( void* pDLLHandle, const char8_t* pDLLPath );
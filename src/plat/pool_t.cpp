@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <new>
+
+#include "pool_t.h"
+
+namespace llce {
+
+/// Helper Functions ///
+
+inline uint64_t packFree( uint64_t pTag, uint32_t pPageID ) {
+    return ( pTag << 32 ) | static_cast<uint64_t>( pPageID );
+}
+
+
+// NOTE(JRC): Free class 'k' holds runs of [2^k, 2^(k+1)) pages.
+inline uint32_t freeClass( uint32_t pPageCount ) {
+    return 31 - __builtin_clz( pPageCount );
+}
+
+/// Class Functions ///
+
+// NOTE(JRC): The given length is the length available to sub-arenas; the pool
+// reserves additional pages ahead of these to hold its table of run headers.
+pool_t::pool_t( uint64_t pBufferLength, bit8_t* pBufferBase, uint32_t pBufferFlags, uint64_t pPageLength ) :
+        mBuffer( nullptr ), mBufferLength( 0 ),
+        mRuns( nullptr ), mPages( nullptr ), mPageLength( pPageLength ), mPageCount( 0 ),
+        mPageCursor( 0 ), mArenaMask( 0 ) {
+    LLCE_CHECK_ERROR( pPageLength != 0 && pPageLength % (2 * sizeof(size_t)) == 0,
+        "Unable to generate memory pool with page length " << pPageLength << "; " <<
+        "pages must be aligned to " << 2 * sizeof(size_t) << " bytes." );
+
+    mPageCount = static_cast<uint32_t>( (pBufferLength + mPageLength - 1) / mPageLength );
+    const uint64_t cTablePageCount = ( mPageCount * sizeof(run_t) + mPageLength - 1 ) / mPageLength;
+    mBufferLength = platform::allocLength( (cTablePageCount + mPageCount) * mPageLength, pBufferFlags );
+
+    mBuffer = platform::allocBuffer( mBufferLength, pBufferBase, pBufferFlags );
+    LLCE_CHECK_ERROR( mBuffer != nullptr,
+        "Unable to allocate memory pool of length " << mBufferLength << " " <<
+        "at base address " << pBufferBase << "." );
+    if( mBuffer == nullptr ) {
+        mPageCount = 0;
+        return;
+    }
+
+    mRuns = (run_t*)mBuffer;
+    mPages = mBuffer + cTablePageCount * mPageLength;
+    for( uint32_t pageIdx = 0; pageIdx < mPageCount; pageIdx++ ) {
+        new( &mRuns[pageIdx] ) run_t();
+    }
+    for( uint32_t classIdx = 0; classIdx < FREE_CLASS_COUNT; classIdx++ ) {
+        mPageFrees[classIdx].store( 0, std::memory_order_relaxed );
+    }
+}
+
+
+pool_t::~pool_t() {
+    LLCE_CHECK_WARNING( mArenaMask.load() == 0,
+        "Releasing memory pool at " << (void*)mBuffer << " with " <<
+        "sub-arenas still active; all outstanding sub-arenas are now invalid." );
+
+    platform::deallocBuffer( mBuffer, mBufferLength );
+}
+
+
+memory_t* pool_t::carve( uint64_t pArenaLength, uint64_t pDataLength ) {
+    // NOTE(JRC): Every run needs at least one page so that it belongs to a free class.
+    const uint32_t cPageCount = std::max<uint32_t>( 1, static_cast<uint32_t>(
+        (pArenaLength + mPageLength - 1) / mPageLength) );
+
+    uint32_t slotIdx = MAX_ARENA_COUNT;
+    uint64_t slotMask = mArenaMask.load( std::memory_order_relaxed );
+    while( ~slotMask != 0 ) {
+        slotIdx = __builtin_ctzll( ~slotMask );
+        if( mArenaMask.compare_exchange_weak(slotMask, slotMask | (1ull << slotIdx),
+                std::memory_order_acquire, std::memory_order_relaxed) ) {
+            break;
+        }
+        slotIdx = MAX_ARENA_COUNT;
+    }
+
+    LLCE_CHECK_WARNING( slotIdx < MAX_ARENA_COUNT,
+        "Unable to carve sub-arena from memory pool at " << (void*)mBuffer << "; " <<
+        "all " << MAX_ARENA_COUNT << " sub-arena slots are in use." );
+    if( slotIdx >= MAX_ARENA_COUNT ) {
+        return nullptr;
+    }
+
+    slot_t& slot = mArenaSlots[slotIdx];
+    if( !supply(cPageCount, slot.mPageIndex, slot.mPageCount) ) {
+        LLCE_CHECK_WARNING( false,
+            "Unable to carve sub-arena of length " << pArenaLength << " " <<
+            "from memory pool at " << (void*)mBuffer << "; insufficient pages remaining." );
+        mArenaMask.fetch_and( ~(1ull << slotIdx), std::memory_order_release );
+        return nullptr;
+    }
+
+    // NOTE(JRC): Recycled runs may be longer than requested, in which case the
+    // surplus is given to the sub-arena (as stack/heap space) instead of being split.
+    return new( slot.mArena ) memory_t(
+        page( slot.mPageIndex ),
+        slot.mPageCount * mPageLength, pDataLength );
+}
+
+
+void pool_t::release( memory_t* pArena ) {
+    const uint64_t cSlotOffset = (bit8_t*)pArena - (bit8_t*)&mArenaSlots[0];
+    const uint32_t cSlotIdx = static_cast<uint32_t>( cSlotOffset / sizeof(slot_t) );
+
+    LLCE_CHECK_ERROR( (bit8_t*)pArena >= (bit8_t*)&mArenaSlots[0] &&
+            cSlotIdx < MAX_ARENA_COUNT && cSlotOffset % sizeof(slot_t) == 0 &&
+            (mArenaMask.load() & (1ull << cSlotIdx)),
+        "Cannot release sub-arena at " << pArena << "; this sub-arena is " <<
+        "either unmanaged by the memory pool or has been released before." );
+
+    slot_t& slot = mArenaSlots[cSlotIdx];
+    pArena->~memory_t();
+    recycle( slot.mPageIndex, slot.mPageCount );
+
+    mArenaMask.fetch_and( ~(1ull << cSlotIdx), std::memory_order_release );
+}
+
+
+// NOTE(JRC): The usage values for each sub-arena are read without synchronizing
+// with its owning thread, so they're only a snapshot when those threads are active.
+void pool_t::report() const {
+    const uint64_t cArenaMask = mArenaMask.load( std::memory_order_acquire );
+    const uint32_t cPageCursor = mPageCursor.load( std::memory_order_relaxed );
+
+    LLCE_INFO_DEBUG( "Memory Pool {" << (void*)mBuffer << "}: " <<
+        cPageCursor << "/" << mPageCount << " pages touched, " <<
+        __builtin_popcountll(cArenaMask) << " sub-arenas active" );
+
+    for( uint32_t slotIdx = 0; slotIdx < MAX_ARENA_COUNT; slotIdx++ ) {
+        if( cArenaMask & (1ull << slotIdx) ) {
+            const memory_t* cArena = (const memory_t*)mArenaSlots[slotIdx].mArena;
+            LLCE_INFO_DEBUG( "  Sub-Arena {" << slotIdx << "}: " <<
+                "data " << cArena->dused() << ", " <<
+                "heap " << cArena->hused() << ", " <<
+                "stack " << cArena->sused() << " of " << cArena->length() << " bytes" );
+        }
+    }
+}
+
+
+bool32_t pool_t::supply( uint32_t pPageCount, uint32_t& pPageIndex, uint32_t& pRunCount ) {
+    // NOTE(JRC): Any run in a free class at or above the request's rounded-up
+    // class is large enough, so each class only needs its head to be checked and
+    // claims stay lock-free. The request's own class is tried first when its
+    // page count isn't a power of two since its head may still be a tighter fit.
+    const uint32_t cFloorClass = freeClass( pPageCount );
+    const uint32_t cCeilClass = cFloorClass + ( (pPageCount & (pPageCount - 1)) != 0 );
+    if( cFloorClass != cCeilClass && claim(cFloorClass, pPageCount, pPageIndex, pRunCount) ) {
+        return true;
+    }
+    for( uint32_t classIdx = cCeilClass; classIdx < FREE_CLASS_COUNT; classIdx++ ) {
+        if( claim(classIdx, pPageCount, pPageIndex, pRunCount) ) {
+            return true;
+        }
+    }
+
+    uint32_t pageCursor = mPageCursor.load( std::memory_order_relaxed );
+    while( pageCursor + pPageCount <= mPageCount ) {
+        if( mPageCursor.compare_exchange_weak(pageCursor, pageCursor + pPageCount,
+                std::memory_order_relaxed, std::memory_order_relaxed) ) {
+            pPageIndex = pageCursor;
+            pRunCount = pPageCount;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+bool32_t pool_t::claim( uint32_t pFreeClass, uint32_t pPageCount, uint32_t& pPageIndex, uint32_t& pRunCount ) {
+    // NOTE(JRC): The header of the head run may be read just after another thread
+    // has claimed that run, but headers live in the pool's table rather than in the
+    // run's pages, so such reads only ever see stale header values; the tag in the
+    // upper half of the head then causes the exchange to fail and the claim to retry.
+    std::atomic<uint64_t>& freeList = mPageFrees[pFreeClass];
+    uint64_t freeHead = freeList.load( std::memory_order_acquire );
+    while( (freeHead & 0xFFFFFFFF) != 0 ) {
+        const uint32_t cRunIdx = static_cast<uint32_t>( freeHead & 0xFFFFFFFF ) - 1;
+        run_t* freeRun = run( cRunIdx );
+
+        const uint32_t cRunCount = freeRun->mPageCount.load( std::memory_order_relaxed );
+        if( cRunCount < pPageCount ) {
+            break;
+        }
+
+        const uint32_t cRunNext = freeRun->mNext.load( std::memory_order_relaxed );
+        if( freeList.compare_exchange_weak(freeHead, packFree((freeHead >> 32) + 1, cRunNext),
+                std::memory_order_acquire, std::memory_order_acquire) ) {
+            pPageIndex = cRunIdx;
+            pRunCount = cRunCount;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void pool_t::recycle( uint32_t pPageIndex, uint32_t pRunCount ) {
+    run_t* freeRun = run( pPageIndex );
+    freeRun->mPageCount.store( pRunCount, std::memory_order_relaxed );
+
+    std::atomic<uint64_t>& freeList = mPageFrees[freeClass( pRunCount )];
+    uint64_t freeHead = freeList.load( std::memory_order_relaxed );
+    do {
+        freeRun->mNext.store( static_cast<uint32_t>(freeHead & 0xFFFFFFFF), std::memory_order_relaxed );
+    } while( !freeList.compare_exchange_weak(freeHead, packFree((freeHead >> 32) + 1, pPageIndex + 1),
+        std::memory_order_release, std::memory_order_relaxed) );
+}
+
+}
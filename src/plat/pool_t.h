@@ -0,0 +1,96 @@
+#ifndef LLCE_POOL_T_H
+#define LLCE_POOL_T_H
+
+#include <atomic>
+
+#include "memory_t.h"
+#include "platform.h"
+#include "consts.h"
+
+// NOTE(JRC): A pool reserves a single (optionally fixed-address) region and
+// carves it into sub-arenas so that multiple threads can allocate from replay-friendly
+// memory at once. Each sub-arena is a regular 'memory_t' that's owned by exactly
+// one thread, so its data/stack/heap allocations remain unsynchronized; only
+// carving and releasing sub-arenas (i.e. the central page supply) is thread-safe.
+// The page supply is lock-free: pages are claimed with an atomic bump cursor and
+// released runs are recycled through tagged (ABA-safe) free lists, one per size class.
+// The free list headers for all runs are kept in a table ahead of the pages so
+// that the supply never reads or writes memory that a sub-arena may own.
+
+namespace llce {
+
+class pool_t {
+    public:
+
+    /// Class Attributes ///
+
+    const static uint32_t MAX_ARENA_COUNT = 64;
+    const static uint32_t FREE_CLASS_COUNT = 32;
+    const static uint64_t DEFAULT_PAGE_LENGTH = 1 << 16;
+
+    /// Constructors ///
+
+    pool_t( uint64_t pBufferLength, bit8_t* pBufferBase = nullptr,
+        uint32_t pBufferFlags = platform::alloc::none,
+        uint64_t pPageLength = DEFAULT_PAGE_LENGTH );
+    ~pool_t();
+
+    /// Class Functions ///
+
+    memory_t* carve( uint64_t pArenaLength, uint64_t pDataLength );
+    void release( memory_t* pArena );
+
+    void report() const;
+
+    inline bit8_t* buffer() const { return mBuffer; }
+    inline uint64_t length() const { return mBufferLength; }
+    inline uint64_t pages() const { return mPageCount; }
+
+    private:
+
+    /// Class Setup ///
+
+    struct run_t {
+        std::atomic<uint32_t> mNext; // page index + 1 of next free run (0 = end)
+        std::atomic<uint32_t> mPageCount;
+    };
+
+    struct slot_t {
+        alignas(memory_t) bit8_t mArena[sizeof(memory_t)];
+        uint32_t mPageIndex;
+        uint32_t mPageCount;
+    };
+
+    /// Class Functions ///
+
+    bool32_t supply( uint32_t pPageCount, uint32_t& pPageIndex, uint32_t& pRunCount );
+    bool32_t claim( uint32_t pFreeClass, uint32_t pPageCount, uint32_t& pPageIndex, uint32_t& pRunCount );
+    void recycle( uint32_t pPageIndex, uint32_t pRunCount );
+
+    inline run_t* run( uint32_t pPageIndex ) const {
+        return &mRuns[pPageIndex];
+    }
+    inline bit8_t* page( uint32_t pPageIndex ) const {
+        return mPages + pPageIndex * mPageLength;
+    }
+
+    /// Class Fields ///
+
+    bit8_t* mBuffer;
+    uint64_t mBufferLength;
+
+    run_t* mRuns;
+    bit8_t* mPages;
+    uint64_t mPageLength;
+    uint32_t mPageCount;
+
+    std::atomic<uint32_t> mPageCursor;
+    std::atomic<uint64_t> mPageFrees[FREE_CLASS_COUNT]; // [tag:32 | page index + 1:32]
+
+    std::atomic<uint64_t> mArenaMask;
+    slot_t mArenaSlots[MAX_ARENA_COUNT];
+};
+
+}
+
+#endif
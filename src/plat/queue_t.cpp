@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <cstring>
+
+#include "queue_t.h"
+
+namespace llce {
+
+/// Class Functions ///
+
+queue_t::queue_t( bit8_t* pBuffer, const uint64_t pBufferCapacity ) :
+        mBuffer( pBuffer ), mBufferCapacity( pBufferCapacity ), mBufferMask( pBufferCapacity - 1 ),
+        mBufferEnd( 0 ), mCachedStart( 0 ),
+        mBufferStart( 0 ), mCachedEnd( 0 ) {
+    LLCE_CHECK_ERROR( pBufferCapacity != 0 && (pBufferCapacity & (pBufferCapacity - 1)) == 0,
+        "Unable to generate queue with capacity " << pBufferCapacity << "; " <<
+        "queue capacities must be powers of two." );
+}
+
+
+queue_t::span_t queue_t::reserve( const uint64_t pDataLength ) {
+    const uint64_t cBufferEnd = mBufferEnd.load( std::memory_order_relaxed );
+    if( mBufferCapacity - (cBufferEnd - mCachedStart) < pDataLength ) {
+        mCachedStart = mBufferStart.load( std::memory_order_acquire );
+    }
+
+    const bool32_t cDataFits = mBufferCapacity - (cBufferEnd - mCachedStart) >= pDataLength;
+    return span( cBufferEnd, cDataFits ? pDataLength : 0 );
+}
+
+
+void queue_t::commit( const uint64_t pDataLength ) {
+    const uint64_t cBufferEnd = mBufferEnd.load( std::memory_order_relaxed );
+    LLCE_CHECK_ERROR( cBufferEnd - mCachedStart + pDataLength <= mBufferCapacity,
+        "Cannot commit " << pDataLength << " bytes to queue at " << (void*)mBuffer << "; " <<
+        "committed data must be reserved beforehand." );
+
+    mBufferEnd.store( cBufferEnd + pDataLength, std::memory_order_release );
+}
+
+
+bool32_t queue_t::enqueue( const bit8_t* pData, const uint64_t pDataLength ) {
+    span_t dataSpan = reserve( pDataLength );
+    bool32_t newDataFits = dataSpan.length() == pDataLength;
+
+    LLCE_CHECK_WARNING( newDataFits,
+        "Couldn't enqueue additional memory at " << pData << " of size " <<
+        pDataLength << "; insufficient queue memory remaining." );
+
+    if( newDataFits ) {
+        std::memcpy( dataSpan.mRegions[0], pData + 0, dataSpan.mLengths[0] );
+        std::memcpy( dataSpan.mRegions[1], pData + dataSpan.mLengths[0], dataSpan.mLengths[1] );
+        commit( pDataLength );
+    }
+
+    return newDataFits;
+}
+
+
+queue_t::span_t queue_t::peek( const uint64_t pDataLength ) {
+    const uint64_t cBufferStart = mBufferStart.load( std::memory_order_relaxed );
+    if( mCachedEnd - cBufferStart < pDataLength ) {
+        mCachedEnd = mBufferEnd.load( std::memory_order_acquire );
+    }
+
+    return span( cBufferStart, std::min(pDataLength, mCachedEnd - cBufferStart) );
+}
+
+
+void queue_t::consume( const uint64_t pDataLength ) {
+    const uint64_t cBufferStart = mBufferStart.load( std::memory_order_relaxed );
+    LLCE_CHECK_ERROR( pDataLength <= mCachedEnd - cBufferStart,
+        "Cannot consume " << pDataLength << " bytes from queue at " << (void*)mBuffer << "; " <<
+        "consumed data must be peeked beforehand." );
+
+    mBufferStart.store( cBufferStart + pDataLength, std::memory_order_release );
+}
+
+
+bool32_t queue_t::dequeue( bit8_t* pData, const uint64_t pDataLength ) {
+    span_t dataSpan = peek( pDataLength );
+    bool32_t hasEnoughData = dataSpan.length() == pDataLength;
+
+    LLCE_CHECK_WARNING( hasEnoughData,
+        "Couldn't dequeue requested memory to " << pData << " of size " <<
+        pDataLength << "; insufficient queue memory available." );
+
+    if( hasEnoughData ) {
+        std::memcpy( pData + 0, dataSpan.mRegions[0], dataSpan.mLengths[0] );
+        std::memcpy( pData + dataSpan.mLengths[0], dataSpan.mRegions[1], dataSpan.mLengths[1] );
+        consume( pDataLength );
+    }
+
+    return hasEnoughData;
+}
+
+
+uint64_t queue_t::length() const {
+    // NOTE(JRC): The start index is loaded first since it never passes the end
+    // index, which ensures that this length never underflows.
+    const uint64_t cBufferStart = mBufferStart.load( std::memory_order_acquire );
+    const uint64_t cBufferEnd = mBufferEnd.load( std::memory_order_acquire );
+    return cBufferEnd - cBufferStart;
+}
+
+
+uint64_t queue_t::capacity() const {
+    return mBufferCapacity;
+}
+
+
+queue_t::span_t queue_t::span( const uint64_t pOffset, const uint64_t pLength ) const {
+    const uint64_t cOffset = pOffset & mBufferMask;
+
+    span_t ring;
+    ring.mRegions[0] = mBuffer + cOffset;
+    ring.mRegions[1] = mBuffer;
+    ring.mLengths[0] = std::min( pLength, mBufferCapacity - cOffset );
+    ring.mLengths[1] = pLength - ring.mLengths[0];
+
+    return ring;
+}
+
+}
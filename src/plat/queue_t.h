@@ -0,0 +1,79 @@
+#ifndef LLCE_QUEUE_T_H
+#define LLCE_QUEUE_T_H
+
+#include <atomic>
+#include <limits>
+
+#include "consts.h"
+
+// NOTE(JRC): This queue is a byte ring buffer that can be shared between exactly
+// one producer thread and one consumer thread without locking. The producer only
+// writes the end index and the consumer only writes the start index; both are
+// monotonic counters that are masked into the buffer, which is why the capacity
+// must be a power of two. Data can either be copied in/out via 'enqueue'/'dequeue'
+// or accessed in place via the 'reserve'/'commit' and 'peek'/'consume' pairs.
+
+namespace llce {
+
+class queue_t {
+    public:
+
+    /// Class Attributes ///
+
+    const static uint64_t CACHE_LINE_LENGTH = 64;
+
+    /// Class Setup ///
+
+    // NOTE(JRC): A span describes a range of the ring, which is split into at
+    // most two contiguous regions when it wraps around the end of the buffer.
+    struct span_t {
+        bit8_t* mRegions[2];
+        uint64_t mLengths[2];
+
+        inline uint64_t length() const { return mLengths[0] + mLengths[1]; }
+    };
+
+    /// Constructors ///
+
+    queue_t( bit8_t* pBuffer, const uint64_t pBufferCapacity );
+
+    /// Class Functions ///
+
+    // producer functions //
+    span_t reserve( const uint64_t pDataLength );
+    void commit( const uint64_t pDataLength );
+    bool32_t enqueue( const bit8_t* pData, const uint64_t pDataLength );
+
+    // consumer functions //
+    span_t peek( const uint64_t pDataLength = std::numeric_limits<uint64_t>::max() );
+    void consume( const uint64_t pDataLength );
+    bool32_t dequeue( bit8_t* pData, const uint64_t pDataLength );
+
+    uint64_t length() const;
+    uint64_t capacity() const;
+
+    private:
+
+    /// Class Functions ///
+
+    span_t span( const uint64_t pOffset, const uint64_t pLength ) const;
+
+    /// Class Fields ///
+
+    bit8_t* mBuffer;
+    uint64_t mBufferCapacity;
+    uint64_t mBufferMask;
+
+    // NOTE(JRC): Each index lives on its own cache line alongside the owning
+    // thread's cached copy of the other index so that the threads only contend
+    // when the cached value is insufficient (see: false sharing).
+    alignas(CACHE_LINE_LENGTH) std::atomic<uint64_t> mBufferEnd;
+    uint64_t mCachedStart;
+
+    alignas(CACHE_LINE_LENGTH) std::atomic<uint64_t> mBufferStart;
+    uint64_t mCachedEnd;
+};
+
+}
+
+#endif
@@ -0,0 +1,67 @@
+#include "sampler_t.h"
+
+namespace llce {
+
+/// Class Functions ///
+
+sampler_t::sampler_t() :
+        mRecordQueue( &mRecordBuffer[0], sizeof(mRecordBuffer) ) {
+    SDL_AddEventWatch( sampler_t::watch, this );
+}
+
+
+sampler_t::~sampler_t() {
+    SDL_DelEventWatch( sampler_t::watch, this );
+}
+
+
+// NOTE(JRC): Pumping invokes the event watch for each new event immediately,
+// so transitions are timestamped to within one pump interval.
+void sampler_t::sample() {
+    SDL_PumpEvents();
+}
+
+
+// NOTE(JRC): Edges are aged relative to the time of the flush, which should
+// immediately precede the read of the device states they're folded into.
+uint32_t sampler_t::flush( input::edge_t* pEdges, const uint32_t pMaxEdges ) {
+    const ClockPoint cFlushTime = Clock::now();
+
+    uint32_t edgeCount = 0;
+    for( record_t record; mRecordQueue.length() >= sizeof(record_t); ) {
+        mRecordQueue.dequeue( (bit8_t*)&record, sizeof(record_t) );
+        if( edgeCount < pMaxEdges ) {
+            SecDuration recordAge = std::chrono::duration_cast<SecDuration>( cFlushTime - record.mTime );
+            pEdges[edgeCount++] = { record.mGID, record.mDiff, static_cast<float32_t>(recordAge.count()) };
+        }
+    }
+
+    return edgeCount;
+}
+
+
+void sampler_t::slice( void* pSampler ) {
+    static_cast<sampler_t*>( pSampler )->sample();
+}
+
+
+int32_t sampler_t::watch( void* pSampler, SDL_Event* pEvent ) {
+    sampler_t* sampler = static_cast<sampler_t*>( pSampler );
+
+    record_t record = { Clock::now(), input::INPUT_UNBOUND_ID, input::diff_e::none };
+    if( (pEvent->type == SDL_KEYDOWN || pEvent->type == SDL_KEYUP) && !pEvent->key.repeat ) {
+        record.mGID = input::stream_t( input::device_e::keyboard, pEvent->key.keysym.scancode );
+        record.mDiff = ( pEvent->type == SDL_KEYDOWN ) ? input::diff_e::down : input::diff_e::up;
+    } else if( pEvent->type == SDL_MOUSEBUTTONDOWN || pEvent->type == SDL_MOUSEBUTTONUP ) {
+        record.mGID = input::stream_t( input::device_e::mouse, pEvent->button.button );
+        record.mDiff = ( pEvent->type == SDL_MOUSEBUTTONDOWN ) ? input::diff_e::down : input::diff_e::up;
+    }
+
+    if( record.mGID != input::INPUT_UNBOUND_ID ) {
+        sampler->mRecordQueue.enqueue( (const bit8_t*)&record, sizeof(record_t) );
+    }
+
+    return 0;
+}
+
+}
@@ -0,0 +1,69 @@
+#ifndef LLCE_SAMPLER_T_H
+#define LLCE_SAMPLER_T_H
+
+#include <SDL2/SDL.h>
+
+#include <chrono>
+
+#include "queue_t.h"
+#include "input.h"
+#include "consts.h"
+
+// NOTE(JRC): The sampler records every button transition reported by the
+// platform along with the time it was observed, which allows taps shorter than
+// a frame to reach the simulation and allows input latency to be measured from
+// the transition itself rather than from the start of the frame. Transitions are
+// passed through a single-producer/single-consumer queue so that the producer
+// can be moved to a dedicated thread for platforms that support off-window input
+// (e.g. evdev); SDL only permits event pumping on the window thread, so the
+// harness currently produces by calling 'sample' while it waits between frames.
+
+namespace llce {
+
+class sampler_t {
+    public:
+
+    /// Class Attributes ///
+
+    const static uint32_t MAX_RECORDS = 256;
+    constexpr static float64_t SAMPLE_PERIOD = 1.0e-3;
+
+    /// Constructors ///
+
+    sampler_t();
+    ~sampler_t();
+
+    /// Class Functions ///
+
+    void sample();
+    uint32_t flush( input::edge_t* pEdges, const uint32_t pMaxEdges );
+
+    static void slice( void* pSampler );
+
+    private:
+
+    /// Class Setup ///
+
+    using Clock = std::chrono::high_resolution_clock;
+    using ClockPoint = decltype( Clock::now() );
+    using SecDuration = std::chrono::duration<float64_t, std::ratio<1>>;
+
+    struct record_t {
+        ClockPoint mTime;
+        uint32_t mGID;
+        input::diff_e mDiff;
+    };
+
+    /// Class Functions ///
+
+    static int32_t watch( void* pSampler, SDL_Event* pEvent );
+
+    /// Class Fields ///
+
+    alignas(queue_t::CACHE_LINE_LENGTH) bit8_t mRecordBuffer[MAX_RECORDS * sizeof(record_t)];
+    queue_t mRecordQueue;
+};
+
+}
+
+#endif
@@ -41,6 +41,28 @@ float64_t timer_t::wait( float64_t pRatio, timer_t::ratio_e pType ) const {
 }
 
 
+// NOTE(JRC): This variant of 'wait' breaks the wait period into slices and
+// invokes the given function at the start of each one, which allows work that
+// needs regular servicing (e.g. input sampling) to continue while waiting.
+float64_t timer_t::wait( timer_t::slice_f pSliceFun, void* pSliceData, float64_t pSliceSecs,
+        float64_t pRatio, timer_t::ratio_e pType ) const {
+    SecDuration frameSecs( (pType == timer_t::ratio_e::spf) ? pRatio : 1.0 / pRatio );
+    ClockDuration frameDuration = ( pRatio == 0.0 ) ? mFrameDuration :
+        std::chrono::duration_cast<ClockDuration>( frameSecs );
+    ClockDuration sliceDuration = std::chrono::duration_cast<ClockDuration>( SecDuration(pSliceSecs) );
+
+    ClockDuration waitTime = frameDuration - ( mFrameSplits.back(0) - mFrameSplits.back(1) );
+    const ClockPoint cWaitEnd = Clock::now() + waitTime;
+    for( ClockPoint waitCurr = Clock::now(); waitCurr < cWaitEnd; waitCurr = Clock::now() ) {
+        pSliceFun( pSliceData );
+        std::this_thread::sleep_for( std::min(sliceDuration, ClockDuration(cWaitEnd - Clock::now())) );
+    }
+
+    SecDuration waitSecs = std::chrono::duration_cast<SecDuration>( waitTime );
+    return static_cast<float64_t>( waitSecs.count() );
+}
+
+
 float64_t timer_t::ft( timer_t::time_e pType ) const {
     ClockDuration prevFrameTime = ( pType == timer_t::time_e::ideal ) ? mFrameDuration :
         std::max( mFrameDuration, mFrameSplits.back(0) - mFrameSplits.back(1) );
@@ -18,6 +18,8 @@ class timer_t {
 
     const static uint32_t CACHE_SIZE = 10;
 
+    typedef void (*slice_f)( void* pSliceData );
+
     /// Constructors ///
 
     timer_t( float64_t pRatio = 60.0, ratio_e pType = ratio_e::fps );
@@ -26,6 +28,8 @@ class timer_t {
 
     float64_t split();
     float64_t wait( float64_t pRatio = 0.0, ratio_e pType = ratio_e::fps ) const;
+    float64_t wait( slice_f pSliceFun, void* pSliceData, float64_t pSliceSecs,
+        float64_t pRatio = 0.0, ratio_e pType = ratio_e::fps ) const;
 
     float64_t ft( time_e pType = time_e::real ) const;
     float64_t tt( time_e pType = time_e::real ) const;
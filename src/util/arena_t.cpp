@@ -0,0 +1,48 @@
+#include <algorithm>
+
+#include "arena_t.h"
+
+namespace llce {
+
+/// Class Functions ///
+
+arena_t::arena_t( bit8_t* pBuffer, const uint64_t pBufferLength, const uint32_t pFrameCount ) :
+        mBuffer( pBuffer ), mBufferLength( pBufferLength ),
+        mFrameCount( pFrameCount ), mFrameIndex( 0 ),
+        mFrameLength( 0 ), mFrameUsed( 0 ), mFramePeak( 0 ) {
+    LLCE_CHECK_ERROR( 0 < pFrameCount && pFrameCount <= MAX_FRAME_COUNT,
+        "Unable to generate frame arena with " << pFrameCount << " frame segments; " <<
+        "arenas support between 1 and " << MAX_FRAME_COUNT << " frame segments." );
+
+    // NOTE(JRC): Each frame segment is trimmed to the alignment boundary so
+    // that the base of every segment (and thus every first allocation) is aligned.
+    mFrameLength = pBufferLength / pFrameCount;
+    mFrameLength -= mFrameLength % ALLOCATION_ALIGNMENT;
+}
+
+
+bit8_t* arena_t::alloc( const uint64_t pAllocLength ) {
+    const uint64_t cAllocLength = pAllocLength +
+        ( ALLOCATION_ALIGNMENT - pAllocLength % ALLOCATION_ALIGNMENT ) % ALLOCATION_ALIGNMENT;
+
+    LLCE_CHECK_ERROR( mFrameUsed + cAllocLength <= mFrameLength,
+        "Cannot allocate an additional frame block of size " << pAllocLength << "; " <<
+        "frame has only " << mFrameLength - mFrameUsed << " remaining bytes available." );
+    if( mFrameUsed + cAllocLength > mFrameLength ) {
+        return nullptr;
+    }
+
+    bit8_t* allocBlock = mBuffer + mFrameIndex * mFrameLength + mFrameUsed;
+    mFrameUsed += cAllocLength;
+    mFramePeak = std::max( mFramePeak, mFrameUsed );
+
+    return allocBlock;
+}
+
+
+void arena_t::flip() {
+    mFrameIndex = ( mFrameIndex + 1 ) % mFrameCount;
+    mFrameUsed = 0;
+}
+
+}
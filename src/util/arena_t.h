@@ -0,0 +1,55 @@
+#ifndef LLCE_ARENA_T_H
+#define LLCE_ARENA_T_H
+
+#include "consts.h"
+
+// NOTE(JRC): This arena is a frame-scoped bump allocator used for transient
+// simulation data (e.g. formatted strings, temporary geometry, etc.). The
+// harness calls 'flip' at the start of each frame, which releases all of the
+// data allocated in the oldest frame segment. When created with multiple frame
+// segments, data allocated in frame 'n' remains valid until frame 'n + count'.
+
+namespace llce {
+
+class arena_t {
+    public:
+
+    /// Class Attributes ///
+
+    const static uint64_t ALLOCATION_ALIGNMENT = 2 * sizeof(size_t);
+    const static uint32_t MAX_FRAME_COUNT = 2;
+
+    /// Constructors ///
+
+    arena_t( bit8_t* pBuffer, const uint64_t pBufferLength, const uint32_t pFrameCount = 1 );
+
+    /// Class Functions ///
+
+    bit8_t* alloc( const uint64_t pAllocLength );
+    template <typename T> T* alloc( const uint64_t pAllocCount = 1 ) {
+        return (T*)alloc( pAllocCount * sizeof(T) );
+    }
+
+    void flip();
+
+    inline uint64_t used() const { return mFrameUsed; }
+    inline uint64_t peak() const { return mFramePeak; }
+    inline uint64_t capacity() const { return mFrameLength; }
+
+    private:
+
+    /// Class Fields ///
+
+    bit8_t* mBuffer;
+    uint64_t mBufferLength;
+
+    uint32_t mFrameCount;
+    uint32_t mFrameIndex;
+    uint64_t mFrameLength;
+    uint64_t mFrameUsed;
+    uint64_t mFramePeak;
+};
+
+}
+
+#endif
@@ -9,51 +9,712 @@
 #include <glm/gtx/vector_angle.hpp>
 #include <glm/gtx/string_cast.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <limits>
 
+#include "scheduler_t.h"
 #include "gfx.h"
 
 namespace llce {
 
 namespace gfx {
 
+/// Helper Types ///
+
+// NOTE(JRC): All primitives are accumulated into a single batch of colored,
+// pre-transformed triangles, which is submitted to the GPU (via a streaming vertex
+// buffer) whenever the render target changes (i.e. on 'fbo_context_t' entry/exit),
+// raw OpenGL calls are requested (i.e. on 'raw_context_t' entry), or the batch fills.
+// The transform/color states of the scoped contexts are tracked in CPU-side stacks
+// instead of the OpenGL matrix/attribute stacks so that they can be applied to
+// vertices as they're batched.
+struct vertex_t {
+    vec2f32_t mPos;
+    vec2f32_t mUV;
+    color4u8_t mColor;
+};
+
+
+// NOTE(JRC): The font glyphs are rasterized into a single texture atlas (see
+// 'llce::gfx::boot') so that each character can be drawn as one textured quad.
+// Every glyph pixel is scaled up to a block of texels with a transparent border,
+// which reproduces the spacing between the pixels of the original geometry. The
+// cell for the (unrenderable) null character is filled instead and serves as the
+// texture for all untextured primitives, which allows all primitives to share
+// a single batch.
+struct atlas_t {
+    const static uint32_t PIXEL_TEXELS = 10;
+    const static uint32_t GLYPH_WIDTH = PIXEL_TEXELS * DIGIT_WIDTH;
+    const static uint32_t GLYPH_HEIGHT = PIXEL_TEXELS * DIGIT_HEIGHT;
+    const static uint32_t GLYPH_COLUMNS = 16, GLYPH_ROWS = 128 / GLYPH_COLUMNS;
+    const static uint32_t WIDTH = GLYPH_COLUMNS * GLYPH_WIDTH;
+    const static uint32_t HEIGHT = GLYPH_ROWS * GLYPH_HEIGHT;
+
+    constexpr static float32_t GLYPH_U = ( GLYPH_WIDTH + 0.0f ) / WIDTH;
+    constexpr static float32_t GLYPH_V = ( GLYPH_HEIGHT + 0.0f ) / HEIGHT;
+};
+
+
+struct batch_t {
+    const static uint32_t MAX_VERTICES = 1 << 14;
+    const static uint32_t MAX_DEPTH = 32;
+
+    vertex_t mVertices[MAX_VERTICES];
+    uint32_t mVertexCount = 0;
+    uint32_t mVertexBufferID = 0;
+    uint32_t mAtlasTextureID = 0;
+
+    mat4f32_t mMatrices[MAX_DEPTH] = { mat4f32_t(1.0f) };
+    uint32_t mMatrixDepth = 0;
+    color4u8_t mColors[MAX_DEPTH] = { color4u8_t(0xff, 0xff, 0xff, 0xff) };
+    uint32_t mColorDepth = 0;
+};
+
+static batch_t sBatch;
+
+// NOTE(JRC): Each stale bit marks a shadowed state whose OpenGL value is unknown
+// (e.g. at startup, or after a draw that leaves the current color undefined), which
+// forces the next write to that state to go through regardless of its shadow value.
+enum stale_e : uint32_t {
+    viewport_stale = 1 << 0, scissor_stale = 1 << 1,
+    projection_stale = 1 << 2, modelview_stale = 1 << 3,
+    framebuffer_stale = 1 << 4, color_stale = 1 << 5,
+    all_stale = ( 1 << 6 ) - 1 };
+
+static state_t sState = {
+    { {0, 0}, {0, 0} }, { {0, 0}, {0, 0} },
+    mat4f32_t( 1.0f ), mat4f32_t( 1.0f ),
+    0,
+    color4u8_t( 0xff, 0xff, 0xff, 0xff ),
+    { 1, 1 },
+    all_stale };
+
+// NOTE(JRC): Software frame buffers are identified by their index in the target
+// list plus one (so that zero still refers to the window), and like OpenGL frame
+// buffers they persist until the application exits.
+//
+// Drawing to a software target only records commands, which are rasterized in
+// bulk by 'llce::gfx::resolve'. Each target's commands are binned into square
+// tiles that are then rasterized in parallel (every tile clips all of its commands
+// to its own bounds, so the results match those of a serial rasterization). Targets
+// are resolved in waves so that independent targets (e.g. the simulation and
+// interface buffers) are rasterized concurrently, while targets that blit from
+// other targets wait until those sources are complete.
+struct command_t {
+    enum type_e : uint32_t { fill_type, triangle_type, blit_type, clear_type };
+
+    type_e mType;
+    color4u8_t mColor;
+    uint32_t mSourceID;
+    vec2i32_t mVertices[3];
+    vec2i32_t mClipMin, mClipMax;
+};
+
+
+struct target_t {
+    raster_t mRaster;
+    command_t* mCommands = nullptr;
+    uint32_t mCommandCount = 0;
+    uint32_t mCommandCapacity = 0;
+    uint32_t* mBins = nullptr;
+    uint32_t mBinCapacity = 0;
+    bool32_t mIsSourced = false;
+};
+
+
+struct job_t {
+    uint32_t mTargetIdx;
+    uint32_t mTileIdx;
+    uint32_t mBinBegin, mBinEnd;
+};
+
+
+struct soft_t {
+    const static uint32_t MAX_TARGETS = 16;
+    const static int32_t TILE_LENGTH = 64;
+    const static uint32_t MAX_TILES_PER_AXIS = ( LLCE_MAX_RESOLUTION + TILE_LENGTH - 1 ) / TILE_LENGTH;
+    const static uint32_t MAX_TILES = MAX_TILES_PER_AXIS * MAX_TILES_PER_AXIS;
+    const static uint32_t MIN_COMMANDS = 1 << 10;
+
+    target_t mTargets[MAX_TARGETS];
+    uint32_t mTargetCount = 0;
+    backend_e mBackend = backend::gl;
+
+    job_t mJobs[MAX_TARGETS * MAX_TILES];
+    uint32_t mTileCounts[MAX_TILES + 1];
+};
+
+static soft_t sSoft;
+
+// NOTE(JRC): Each command in a list is stored as an entry header followed by
+// its payload, which is padded so that all entries remain 4-byte aligned. While
+// recording, the shadowed state tracks the recorded state changes (so that state
+// queries are still accurate), and the actual state is restored once recording
+// ends. The shadowed state is also marked as stale during recording so that each
+// list sets every state it depends on, and can thus be executed from any state.
+struct entry_t {
+    uint8_t mType;
+    uint8_t mFlags;
+    uint16_t mCount;
+    uint32_t mLength;
+};
+
+
+struct recorder_t {
+    list_t* mList = nullptr;
+    state_t mState;
+};
+
+static recorder_t sRecorder;
+
+
+// NOTE(JRC): Layers track the per-frame-buffer data that outlives any one frame,
+// which includes the content key and (for multisampled frame buffers) the
+// single-sample frame buffer that the frame buffer is resolved into.
+struct layer_t {
+    uint32_t mFrameID;
+    uint32_t mResolveID;
+    vec2u32_t mRes;
+    uint64_t mContentKey;
+};
+
+
+struct layers_t {
+    const static uint32_t MAX_LAYERS = 32;
+
+    layer_t mLayers[MAX_LAYERS];
+    uint32_t mLayerCount = 0;
+};
+
+static layers_t sLayers;
+
+
+// NOTE(JRC): Timer contexts are measured with pairs of 'GL_TIMESTAMP' queries
+// (which, unlike 'GL_TIME_ELAPSED' queries, can be nested) that are issued into
+// a ring of per-frame slots. Each slot is only read back once the ring wraps back
+// around to it, by which point its queries have almost always completed; slots with
+// incomplete queries are dropped rather than waited on.
+struct timing_t {
+    pass_e mPass;
+    uint32_t mQueryIDs[2];
+};
+
+
+struct profile_t {
+    const static uint32_t MAX_FRAMES = 4;
+    const static uint32_t MAX_TIMINGS = 32;
+    const static uint32_t MAX_DEPTH = 8;
+
+    timing_t mTimings[MAX_FRAMES][MAX_TIMINGS];
+    uint32_t mTimingCounts[MAX_FRAMES] = {};
+    uint32_t mFrameIdx = 0;
+
+    uint32_t mTimingStack[MAX_DEPTH];
+    uint32_t mTimingDepth = 0;
+    bool32_t mIsProfiling = false;
+};
+
+static profile_t sProfile;
+
+/// Helper Functions ///
+
+target_t* softTarget( const uint32_t pFBID ) {
+    return ( pFBID > 0 && pFBID <= sSoft.mTargetCount ) ? &sSoft.mTargets[pFBID - 1] : nullptr;
+}
+
+
+// NOTE(JRC): The scheduler is created on first use so that its worker threads are
+// only spawned by applications that actually use the software backend.
+scheduler_t& softScheduler() {
+    static scheduler_t sScheduler;
+    return sScheduler;
+}
+
+
+// NOTE(JRC): The returned bounds are conservative (i.e. they may include pixels
+// that the command doesn't cover), which is sufficient for binning since each
+// command is still clipped exactly during rasterization.
+void softBounds( const command_t& pCommand, vec2i32_t& pMin, vec2i32_t& pMax ) {
+    const vec2i32_t* cVertices = &pCommand.mVertices[0];
+    if( pCommand.mType == command_t::clear_type ) {
+        pMin = pCommand.mClipMin;
+        pMax = pCommand.mClipMax;
+    } else if( pCommand.mType == command_t::blit_type ) {
+        pMin = cVertices[0];
+        pMax = cVertices[0] + cVertices[1];
+    } else {
+        const uint32_t cVertexCount = ( pCommand.mType == command_t::fill_type ) ? 2 : 3;
+        pMin = pMax = cVertices[0];
+        for( uint32_t vertexIdx = 1; vertexIdx < cVertexCount; vertexIdx++ ) {
+            pMin = glm::min( pMin, cVertices[vertexIdx] );
+            pMax = glm::max( pMax, cVertices[vertexIdx] );
+        }
+        pMin = vec2i32_t( pMin.x >> raster_t::SUBPIXEL_BITS, pMin.y >> raster_t::SUBPIXEL_BITS );
+        pMax = vec2i32_t( (pMax.x >> raster_t::SUBPIXEL_BITS) + 1, (pMax.y >> raster_t::SUBPIXEL_BITS) + 1 );
+    }
+
+    pMin = glm::max( pMin, pCommand.mClipMin );
+    pMax = glm::min( pMax, pCommand.mClipMax );
+}
+
+
+// NOTE(JRC): Binning is done via a counting sort, which stores the commands for
+// every tile (in submission order) contiguously in the target's bin list.
+bool32_t softBin( const uint32_t pTargetIdx, uint32_t& pJobCount ) {
+    target_t& target = sSoft.mTargets[pTargetIdx];
+    const vec2i32_t cTileCounts(
+        ( target.mRaster.mRes.x + soft_t::TILE_LENGTH - 1 ) / soft_t::TILE_LENGTH,
+        ( target.mRaster.mRes.y + soft_t::TILE_LENGTH - 1 ) / soft_t::TILE_LENGTH );
+    uint32_t* tileCounts = &sSoft.mTileCounts[0];
+    std::memset( tileCounts, 0, (cTileCounts.x * cTileCounts.y + 1) * sizeof(uint32_t) );
+
+    const auto cForTiles = [&] ( const command_t& pCommand, auto pTileFunction ) {
+        vec2i32_t boundsMin, boundsMax;
+        softBounds( pCommand, boundsMin, boundsMax );
+        if( boundsMin.x >= boundsMax.x || boundsMin.y >= boundsMax.y ) {
+            return;
+        }
+
+        const vec2i32_t cTileMin = boundsMin / soft_t::TILE_LENGTH;
+        const vec2i32_t cTileMax = ( boundsMax - 1 ) / soft_t::TILE_LENGTH;
+        for( int32_t tileY = cTileMin.y; tileY <= cTileMax.y; tileY++ ) {
+            for( int32_t tileX = cTileMin.x; tileX <= cTileMax.x; tileX++ ) {
+                pTileFunction( tileY * cTileCounts.x + tileX );
+            }
+        }
+    };
+
+    for( uint32_t commandIdx = 0; commandIdx < target.mCommandCount; commandIdx++ ) {
+        cForTiles( target.mCommands[commandIdx], [&] ( const uint32_t pTileIdx ) {
+            tileCounts[pTileIdx + 1]++; } );
+    }
+    for( int32_t tileIdx = 0; tileIdx < cTileCounts.x * cTileCounts.y; tileIdx++ ) {
+        tileCounts[tileIdx + 1] += tileCounts[tileIdx];
+    }
+
+    const uint32_t cBinCount = tileCounts[cTileCounts.x * cTileCounts.y];
+    if( cBinCount > target.mBinCapacity ) {
+        const uint32_t cBinCapacity = std::max( cBinCount, 2 * target.mBinCapacity );
+        uint32_t* bins = (uint32_t*)std::realloc( target.mBins, cBinCapacity * sizeof(uint32_t) );
+        LLCE_CHECK_WARNING( bins != nullptr,
+            "Unable to allocate " << cBinCapacity << " tile bins for software " <<
+            "frame buffer " << pTargetIdx + 1 << "; its commands will be dropped." );
+        if( bins == nullptr ) {
+            target.mCommandCount = 0;
+            return false;
+        }
+        target.mBins = bins;
+        target.mBinCapacity = cBinCapacity;
+    }
+
+    for( int32_t tileIdx = 0; tileIdx < cTileCounts.x * cTileCounts.y; tileIdx++ ) {
+        if( tileCounts[tileIdx] < tileCounts[tileIdx + 1] ) {
+            sSoft.mJobs[pJobCount++] = { pTargetIdx, static_cast<uint32_t>(tileIdx),
+                tileCounts[tileIdx], tileCounts[tileIdx + 1] };
+        }
+    }
+    for( uint32_t commandIdx = 0; commandIdx < target.mCommandCount; commandIdx++ ) {
+        cForTiles( target.mCommands[commandIdx], [&] ( const uint32_t pTileIdx ) {
+            target.mBins[tileCounts[pTileIdx]++] = commandIdx; } );
+    }
+
+    return true;
+}
+
+
+void softTile( void* pJobs, const uint32_t pJobIdx ) {
+    const job_t& cJob = static_cast<const job_t*>( pJobs )[pJobIdx];
+    const target_t& cTarget = sSoft.mTargets[cJob.mTargetIdx];
+
+    const int32_t cTileCountX = ( cTarget.mRaster.mRes.x + soft_t::TILE_LENGTH - 1 ) / soft_t::TILE_LENGTH;
+    const vec2i32_t cTileMin(
+        soft_t::TILE_LENGTH * static_cast<int32_t>(cJob.mTileIdx % cTileCountX),
+        soft_t::TILE_LENGTH * static_cast<int32_t>(cJob.mTileIdx / cTileCountX) );
+    const vec2i32_t cTileMax = cTileMin + soft_t::TILE_LENGTH;
+
+    raster_t tile = cTarget.mRaster;
+    for( uint32_t binIdx = cJob.mBinBegin; binIdx < cJob.mBinEnd; binIdx++ ) {
+        const command_t& cCommand = cTarget.mCommands[cTarget.mBins[binIdx]];
+        tile.mClipMin = glm::max( cCommand.mClipMin, cTileMin );
+        tile.mClipMax = glm::min( cCommand.mClipMax, cTileMax );
+
+        if( cCommand.mType == command_t::fill_type ) {
+            tile.fill( cCommand.mVertices[0], cCommand.mVertices[1], cCommand.mColor );
+        } else if( cCommand.mType == command_t::triangle_type ) {
+            tile.triangle( cCommand.mVertices, cCommand.mColor );
+        } else if( cCommand.mType == command_t::blit_type ) {
+            tile.blit( sSoft.mTargets[cCommand.mSourceID - 1].mRaster, cCommand.mVertices[2],
+                cCommand.mVertices[0], cCommand.mVertices[1] );
+        } else if( cCommand.mType == command_t::clear_type ) {
+            tile.clear( cCommand.mColor );
+        }
+    }
+}
+
+void softResolve() {
+    // NOTE(JRC): A target is ready once none of the targets it blits from have
+    // any pending commands; the blit dependencies can't contain cycles since
+    // recording to a target that's the source of pending blits forces a resolve.
+    for( bool32_t isPending = true; isPending; ) {
+        uint32_t jobCount = 0, readyMask = 0;
+        for( uint32_t targetIdx = 0; targetIdx < sSoft.mTargetCount; targetIdx++ ) {
+            const target_t& cTarget = sSoft.mTargets[targetIdx];
+            bool32_t isReady = cTarget.mCommandCount > 0;
+            for( uint32_t commandIdx = 0; commandIdx < cTarget.mCommandCount && isReady; commandIdx++ ) {
+                const command_t& cCommand = cTarget.mCommands[commandIdx];
+                isReady = cCommand.mType != command_t::blit_type || cCommand.mSourceID == targetIdx + 1 ||
+                    sSoft.mTargets[cCommand.mSourceID - 1].mCommandCount == 0;
+            }
+            if( isReady && softBin(targetIdx, jobCount) ) {
+                readyMask |= 1 << targetIdx;
+            }
+        }
+
+        softScheduler().run( softTile, &sSoft.mJobs[0], jobCount );
+
+        isPending = false;
+        for( uint32_t targetIdx = 0; targetIdx < sSoft.mTargetCount; targetIdx++ ) {
+            target_t& target = sSoft.mTargets[targetIdx];
+            if( readyMask & (1 << targetIdx) ) {
+                target.mCommandCount = 0;
+            }
+            isPending |= target.mCommandCount > 0;
+        }
+        LLCE_CHECK_ERROR( !isPending || readyMask != 0,
+            "Unable to resolve software frame buffers; cyclic blit dependency encountered." );
+        isPending &= readyMask != 0;
+    }
+
+    for( uint32_t targetIdx = 0; targetIdx < sSoft.mTargetCount; targetIdx++ ) {
+        sSoft.mTargets[targetIdx].mIsSourced = false;
+    }
+}
+
+
+command_t softCommand( const command_t::type_e pType, const color4u8_t& pColor, const bool32_t pIsClipped = true ) {
+    raster_t clipRaster;
+    const target_t* cTarget = softTarget( sState.mFrameID );
+    if( cTarget != nullptr ) {
+        clipRaster = cTarget->mRaster;
+    }
+    if( pIsClipped ) {
+        clipRaster.clip( sState.mScissor[0], sState.mScissor[1] );
+    }
+
+    command_t command;
+    command.mType = pType;
+    command.mColor = pColor;
+    command.mSourceID = 0;
+    command.mClipMin = clipRaster.mClipMin;
+    command.mClipMax = clipRaster.mClipMax;
+    return command;
+}
+
+
+void softRecord( const uint32_t pFBID, const command_t& pCommand ) {
+    target_t* target = softTarget( pFBID );
+    if( target == nullptr ) {
+        return;
+    } else if( target->mIsSourced ) {
+        // NOTE(JRC): Pending blits read from this target, so their commands
+        // need to be rasterized before this target is changed.
+        softResolve();
+    }
+
+    if( target->mCommandCount == target->mCommandCapacity ) {
+        const uint32_t cCommandCapacity = std::max( 2 * target->mCommandCapacity, soft_t::MIN_COMMANDS );
+        command_t* commands = (command_t*)std::realloc( target->mCommands, cCommandCapacity * sizeof(command_t) );
+        if( commands != nullptr ) {
+            target->mCommands = commands;
+            target->mCommandCapacity = cCommandCapacity;
+        } else {
+            softResolve();
+        }
+    }
+
+    if( target->mCommandCount < target->mCommandCapacity ) {
+        target->mCommands[target->mCommandCount++] = pCommand;
+    }
+}
+
+
+// NOTE(JRC): Layers are kept outside of the simulation memory (along with the frame
+// buffers themselves), so their keys stay in sync with the frame buffers' contents
+// even when the simulation state is reverted or reloaded.
+layer_t* findLayer( const uint32_t pFBID ) {
+    for( uint32_t layerIdx = 0; layerIdx < sLayers.mLayerCount; layerIdx++ ) {
+        if( sLayers.mLayers[layerIdx].mFrameID == pFBID ) {
+            return &sLayers.mLayers[layerIdx];
+        }
+    }
+
+    if( sLayers.mLayerCount < layers_t::MAX_LAYERS ) {
+        sLayers.mLayers[sLayers.mLayerCount] = { pFBID, 0, {0, 0}, CONTENT_UNKEYED };
+        return &sLayers.mLayers[sLayers.mLayerCount++];
+    }
+
+    return nullptr;
+}
+
+
+void listSpill() {
+    // NOTE(JRC): A full list is executed and emptied in place, which keeps the
+    // output correct at the cost of interleaving execution with recording.
+    list_t* list = sRecorder.mList;
+    sRecorder.mList = nullptr;
+    sState = sRecorder.mState;
+
+    llce::gfx::execute( *list );
+
+    sRecorder.mState = sState;
+    sState.mStaleMask = all_stale;
+    sRecorder.mList = list;
+    list->mLength = 0;
+    list->mSpillCount++;
+}
+
+
+bit8_t* listAlloc( const command_e pType, const uint64_t pPayloadLength,
+        const uint32_t pCount = 0, const bool32_t pFlags = false ) {
+    const uint64_t cEntryLength = sizeof( entry_t ) + ( (pPayloadLength + 3) & ~3ULL );
+    list_t* list = sRecorder.mList;
+    if( list->mLength + cEntryLength > list->mBufferLength ) {
+        listSpill();
+    }
+
+    LLCE_CHECK_WARNING( list->mLength + cEntryLength <= list->mBufferLength,
+        "Unable to record graphics command of " << cEntryLength << " bytes; " <<
+        "command list capacity of " << list->mBufferLength << " bytes exceeded." );
+    if( list->mLength + cEntryLength > list->mBufferLength ) {
+        return nullptr;
+    }
+
+    // NOTE(JRC): Payload padding is zeroed so that identical sequences of commands
+    // are always encoded as identical bytes (see 'list_t::key').
+    entry_t* entry = (entry_t*)&list->mBuffer[list->mLength];
+    std::memset( (bit8_t*)(entry + 1) + pPayloadLength, 0, cEntryLength - sizeof(entry_t) - pPayloadLength );
+    entry->mType = static_cast<uint8_t>( pType );
+    entry->mFlags = static_cast<uint8_t>( pFlags );
+    entry->mCount = static_cast<uint16_t>( pCount );
+    entry->mLength = static_cast<uint32_t>( cEntryLength );
+
+    list->mLength += cEntryLength;
+    list->mPeakLength = std::max( list->mPeakLength, list->mLength );
+    list->mCounts[pType]++;
+    return (bit8_t*)( entry + 1 );
+}
+
+
+template <typename... Ts>
+void listRecord( const command_e pType, const Ts&... pArgs ) {
+    bit8_t* payload = listAlloc( pType, (sizeof(Ts) + ... + 0) );
+    if( payload != nullptr ) {
+        ( (std::memcpy(payload, &pArgs, sizeof(Ts)), payload += sizeof(Ts)), ... );
+    }
+}
+
+
+template <typename T>
+T listRead( const bit8_t*& pPayload ) {
+    T value;
+    std::memcpy( &value, pPayload, sizeof(T) );
+    pPayload += sizeof( T );
+    return value;
+}
+
+
+void clear() {
+    if( sRecorder.mList != nullptr ) {
+        listRecord( command::clear );
+    } else if( sSoft.mBackend == backend::soft ) {
+        // NOTE(JRC): Since a clear overwrites the whole target, all of the target's
+        // pending commands can be discarded instead of rasterized.
+        target_t* target = softTarget( sState.mFrameID );
+        if( target != nullptr ) {
+            if( !target->mIsSourced ) {
+                target->mCommandCount = 0;
+            }
+            softRecord( sState.mFrameID, softCommand(command_t::clear_type, color4u8_t(0x00, 0x00, 0x00, 0x00), false) );
+        }
+    } else {
+        glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+    }
+}
+
+
+void resolve( const uint32_t pFBID ) {
+    const layer_t* cLayer = findLayer( pFBID );
+    if( cLayer == nullptr || cLayer->mResolveID == 0 ) {
+        return;
+    } else if( sRecorder.mList != nullptr ) {
+        listRecord( command::resolve, pFBID );
+        return;
+    }
+
+    glBindFramebuffer( GL_READ_FRAMEBUFFER, pFBID );
+    glBindFramebuffer( GL_DRAW_FRAMEBUFFER, cLayer->mResolveID );
+    glBlitFramebuffer( 0, 0, cLayer->mRes.x, cLayer->mRes.y, 0, 0, cLayer->mRes.x, cLayer->mRes.y,
+        GL_COLOR_BUFFER_BIT, GL_NEAREST );
+    glBindFramebuffer( GL_FRAMEBUFFER, sState.mFrameID );
+}
+
+
+void mark( const pass_e pPass, const bool32_t pIsStart ) {
+    if( !sProfile.mIsProfiling ) {
+        return;
+    } else if( sRecorder.mList != nullptr ) {
+        listRecord( command::timestamp, pPass, pIsStart );
+        return;
+    } else if( sSoft.mBackend == backend::soft ) {
+        return;
+    }
+
+    llce::gfx::flush();
+
+    // NOTE(JRC): Timings that don't fit into the current frame's slot are still
+    // pushed onto the stack (as invalid indices) so that they're closed in order.
+    uint32_t& timingCount = sProfile.mTimingCounts[sProfile.mFrameIdx];
+    if( pIsStart ) {
+        LLCE_CHECK_ERROR( sProfile.mTimingDepth < profile_t::MAX_DEPTH,
+            "Unable to push timer context; maximum context depth of " <<
+            profile_t::MAX_DEPTH << " exceeded." );
+
+        sProfile.mTimingStack[sProfile.mTimingDepth++] = timingCount;
+        if( timingCount < profile_t::MAX_TIMINGS ) {
+            timing_t& timing = sProfile.mTimings[sProfile.mFrameIdx][timingCount++];
+            timing.mPass = pPass;
+            glQueryCounter( timing.mQueryIDs[0], GL_TIMESTAMP );
+        }
+    } else if( sProfile.mTimingDepth > 0 ) {
+        const uint32_t cTimingIdx = sProfile.mTimingStack[--sProfile.mTimingDepth];
+        if( cTimingIdx < timingCount ) {
+            glQueryCounter( sProfile.mTimings[sProfile.mFrameIdx][cTimingIdx].mQueryIDs[1], GL_TIMESTAMP );
+        }
+    }
+}
+
+
+void pushMatrix( const mat4f32_t& pMatrix ) {
+    LLCE_CHECK_ERROR( sBatch.mMatrixDepth + 1 < batch_t::MAX_DEPTH,
+        "Unable to push render context; maximum context depth of " <<
+        batch_t::MAX_DEPTH << " exceeded." );
+
+    sBatch.mMatrices[sBatch.mMatrixDepth + 1] = sBatch.mMatrices[sBatch.mMatrixDepth] * pMatrix;
+    sBatch.mMatrixDepth++;
+}
+
+
+void popMatrix() {
+    sBatch.mMatrixDepth--;
+}
+
+
+void pushColor( const color4u8_t& pColor ) {
+    LLCE_CHECK_ERROR( sBatch.mColorDepth + 1 < batch_t::MAX_DEPTH,
+        "Unable to push color context; maximum context depth of " <<
+        batch_t::MAX_DEPTH << " exceeded." );
+
+    sBatch.mColors[++sBatch.mColorDepth] = pColor;
+}
+
+
+void popColor() {
+    sBatch.mColorDepth--;
+}
+
+
+// NOTE(JRC): Vertices are given as a convex polygon (i.e. a triangle fan), which
+// is transformed by the current context matrix and split into triangles.
+void emit( const vec2f32_t* pVertices, const uint32_t pVertexCount, const vec2f32_t* pUVs = nullptr ) {
+    if( pVertexCount < 3 ) {
+        return;
+    }
+
+    const mat4f32_t& cMatrix = sBatch.mMatrices[sBatch.mMatrixDepth];
+    const color4u8_t& cColor = sBatch.mColors[sBatch.mColorDepth];
+    const auto cTransform = [&cMatrix] ( const vec2f32_t& pVertex ) {
+        return vec2f32_t(
+            cMatrix[0][0] * pVertex.x + cMatrix[1][0] * pVertex.y + cMatrix[3][0],
+            cMatrix[0][1] * pVertex.x + cMatrix[1][1] * pVertex.y + cMatrix[3][1] );
+    };
+
+    if( sRecorder.mList != nullptr ) {
+        const uint64_t cVertexBytes = pVertexCount * sizeof( vec2f32_t );
+        bit8_t* payload = listAlloc( command::polygon,
+            sizeof(color4u8_t) + ((pUVs != nullptr) ? 2 : 1) * cVertexBytes, pVertexCount, pUVs != nullptr );
+        if( payload != nullptr ) {
+            std::memcpy( payload, &cColor, sizeof(color4u8_t) );
+            vec2f32_t* payloadVertices = (vec2f32_t*)( payload + sizeof(color4u8_t) );
+            for( uint32_t vertexIdx = 0; vertexIdx < pVertexCount; vertexIdx++ ) {
+                payloadVertices[vertexIdx] = cTransform( pVertices[vertexIdx] );
+            }
+            if( pUVs != nullptr ) {
+                std::memcpy( payloadVertices + pVertexCount, pUVs, cVertexBytes );
+            }
+        }
+        return;
+    }
+
+    const uint32_t cTriangleVertexCount = 3 * ( pVertexCount - 2 );
+    if( sBatch.mVertexCount + cTriangleVertexCount > batch_t::MAX_VERTICES ) {
+        llce::gfx::flush();
+    }
+
+    const static vec2f32_t csBlankUV( atlas_t::GLYPH_U / 2.0f, atlas_t::GLYPH_V / 2.0f );
+    const auto cTexture = [&pUVs] ( const uint32_t pVertexIdx ) {
+        return ( pUVs != nullptr ) ? pUVs[pVertexIdx] : csBlankUV;
+    };
+
+    const vertex_t cFanOrigin = { cTransform(pVertices[0]), cTexture(0), cColor };
+    vertex_t fanPrev = { cTransform(pVertices[1]), cTexture(1), cColor };
+    vertex_t* batchVertices = &sBatch.mVertices[sBatch.mVertexCount];
+    for( uint32_t vertexIdx = 2; vertexIdx < pVertexCount; vertexIdx++ ) {
+        const vertex_t cFanNext = { cTransform(pVertices[vertexIdx]), cTexture(vertexIdx), cColor };
+        *batchVertices++ = cFanOrigin;
+        *batchVertices++ = fanPrev;
+        *batchVertices++ = cFanNext;
+        fanPrev = cFanNext;
+    }
+    sBatch.mVertexCount += cTriangleVertexCount;
+}
+
 /// 'llce::gfx::color_context_t' Functions ///
 
 color_context_t::color_context_t( const color4u8_t* pColor ) {
-    glPushAttrib( GL_CURRENT_BIT );
-    glColor4ubv( (uint8_t*)pColor );
+    pushColor( *pColor );
 }
 
 
 color_context_t::color_context_t( const color4f32_t* pColor ) {
-    glPushAttrib( GL_CURRENT_BIT );
-    glColor4fv( (float32_t*)pColor );
+    pushColor( llce::gfx::color::f322u8(*pColor) );
 }
 
 
 color_context_t::~color_context_t() {
-    glPopAttrib();
+    popColor();
 }
 
 
 void color_context_t::update( const color4u8_t* pColor ) {
-    glColor4ubv( (uint8_t*)pColor );
+    sBatch.mColors[sBatch.mColorDepth] = *pColor;
 }
 
 
 void color_context_t::update( const color4f32_t* pColor ) {
-    glColor4fv( (float32_t*)pColor );
+    sBatch.mColors[sBatch.mColorDepth] = llce::gfx::color::f322u8( *pColor );
 }
 
 /// 'llce::gfx::render_context_t' Functions ///
 
 render_context_t::render_context_t( const box_t& pBox ) {
-    glPushMatrix();
     mat4f32_t matModelWorld( 1.0f );
     matModelWorld *= glm::translate( vec3f32_t(pBox.mPos.x, pBox.mPos.y, 0.0f) );
     matModelWorld *= glm::scale( vec3f32_t(pBox.mDims.x, pBox.mDims.y, 1.0f) );
-    glMultMatrixf( &matModelWorld[0][0] );
+    pushMatrix( matModelWorld );
 }
 
 
@@ -74,7 +735,7 @@ render_context_t::render_context_t( const box_t& pBox, const float32_t pScreenRa
     mat4f32_t matRatio( 1.0f );
     matRatio *= glm::translate( vec3f32_t(ratioBox.mPos.x, ratioBox.mPos.y, 0.0f) );
     matRatio *= glm::scale( vec3f32_t(ratioBox.mDims.x, ratioBox.mDims.y, 1.0f) );
-    glMultMatrixf( &matRatio[0][0] );
+    sBatch.mMatrices[sBatch.mMatrixDepth] *= matRatio;
 }
 
 
@@ -89,76 +750,312 @@ render_context_t::render_context_t( const vec2f32_t& pPos, const vec2f32_t& pBas
         "(U, V): (" << glm::to_string(pBasisX) << ", " << glm::to_string(pBasisY) <<
         "); only systems with non-skew, counterclockwise bases are currently supported." );
 
-    glPushMatrix();
     mat4f32_t matModelWorld( 1.0f );
     matModelWorld *= glm::translate( vec3f32_t(pPos.x, pPos.y, 0.0f) );
     matModelWorld *= glm::rotate( glm::orientedAngle(vec2f32_t(1.0f, 0.0f), glm::normalize(pBasisX)), csBasisZ );
     matModelWorld *= glm::scale( vec3f32_t(glm::length(pBasisX), glm::length(pBasisY), 1.0f) );
-    glMultMatrixf( &matModelWorld[0][0] );
+    pushMatrix( matModelWorld );
 }
 
 
 render_context_t::~render_context_t() {
-    glPopMatrix();
+    popMatrix();
+}
+
+/// 'llce::gfx::raw_context_t' Functions ///
+
+raw_context_t::raw_context_t() : mModelview( sState.mModelview ), mColor( sState.mColor ) {
+    llce::gfx::flush();
+
+    llce::gfx::state::modelview( mModelview * sBatch.mMatrices[sBatch.mMatrixDepth] );
+    llce::gfx::state::color( sBatch.mColors[sBatch.mColorDepth] );
+}
+
+
+raw_context_t::~raw_context_t() {
+    llce::gfx::state::modelview( mModelview );
+    llce::gfx::state::color( mColor );
+}
+
+/// 'llce::gfx::timer_context_t' Functions ///
+
+timer_context_t::timer_context_t( const pass_e pPass ) : mPass( pPass ) {
+    llce::gfx::mark( mPass, true );
+}
+
+
+timer_context_t::~timer_context_t() {
+    llce::gfx::mark( mPass, false );
 }
 
 /// 'llce::gfx::fbo_t' Functions ///
 
-fbo_t::fbo_t( const vec2u32_t pFBRes ) {
-    glGenFramebuffers( 1, &mFrameID );
-    glBindFramebuffer( GL_FRAMEBUFFER, mFrameID );
+// NOTE(JRC): The software backend always uses 8-bit RGBA color without depth or
+// multisampling, so only the frame buffer resolution applies to its frame buffers.
+fbo_t::fbo_t( const vec2u32_t pFBRes, const format_t& pFormat ) : mResolveID( 0 ) {
+    if( sSoft.mBackend == backend::soft ) {
+        mFrameID = mColorID = mDepthID = 0;
+        LLCE_CHECK_ERROR( sSoft.mTargetCount < soft_t::MAX_TARGETS,
+            "Unable to generate software frame buffer; maximum frame buffer " <<
+            "count of " << soft_t::MAX_TARGETS << " exceeded." );
+
+        color4u8_t* targetPixels = (color4u8_t*)std::calloc( pFBRes.x * pFBRes.y, sizeof(color4u8_t) );
+        if( targetPixels != nullptr ) {
+            sSoft.mTargets[sSoft.mTargetCount++].mRaster = raster_t( targetPixels, pFBRes );
+            mFrameID = mColorID = sSoft.mTargetCount;
+        }
+        return;
+    }
+
+    const GLenum cColorFormat = ( pFormat.mPixel == pixel::rgb565 ) ? GL_RGB565 : GL_RGBA8;
+    int32_t maxSamples = 1;
+    if( pFormat.mSamples > 1 ) {
+        glGetIntegerv( GL_MAX_SAMPLES, &maxSamples );
+    }
+    const int32_t cSamples = std::min( static_cast<int32_t>(pFormat.mSamples), maxSamples );
 
     glGenTextures( 1, &mColorID );
     glBindTexture( GL_TEXTURE_2D, mColorID );
     glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
     glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
-    glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, pFBRes.x, pFBRes.y,
+    glTexImage2D( GL_TEXTURE_2D, 0, cColorFormat, pFBRes.x, pFBRes.y,
         0, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8, nullptr );
-    glFramebufferTexture2D( GL_FRAMEBUFFER,
-        GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mColorID, 0 );
 
-    glGenTextures( 1, &mDepthID );
-    glBindTexture( GL_TEXTURE_2D, mDepthID );
-    glTexImage2D( GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32, pFBRes.x, pFBRes.y,
-        0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, nullptr );
-    glFramebufferTexture2D( GL_FRAMEBUFFER,
-        GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, mDepthID, 0 );
+    // NOTE(JRC): Multisampled frame buffers render into renderbuffers, which are
+    // resolved into the color texture of a separate single-sample frame buffer
+    // whenever rendering to them completes (see 'fbo_context_t').
+    if( cSamples > 1 ) {
+        glGenFramebuffers( 1, &mResolveID );
+        glBindFramebuffer( GL_FRAMEBUFFER, mResolveID );
+        glFramebufferTexture2D( GL_FRAMEBUFFER,
+            GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mColorID, 0 );
+    }
+
+    glGenFramebuffers( 1, &mFrameID );
+    llce::gfx::state::framebuffer( mFrameID );
+
+    if( cSamples > 1 ) {
+        uint32_t colorSamplesID = 0;
+        glGenRenderbuffers( 1, &colorSamplesID );
+        glBindRenderbuffer( GL_RENDERBUFFER, colorSamplesID );
+        glRenderbufferStorageMultisample( GL_RENDERBUFFER, cSamples, cColorFormat, pFBRes.x, pFBRes.y );
+        glFramebufferRenderbuffer( GL_FRAMEBUFFER,
+            GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorSamplesID );
+
+        mDepthID = 0;
+        if( pFormat.mHasDepth ) {
+            glGenRenderbuffers( 1, &mDepthID );
+            glBindRenderbuffer( GL_RENDERBUFFER, mDepthID );
+            glRenderbufferStorageMultisample( GL_RENDERBUFFER, cSamples, GL_DEPTH_COMPONENT32, pFBRes.x, pFBRes.y );
+            glFramebufferRenderbuffer( GL_FRAMEBUFFER,
+                GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, mDepthID );
+        }
+        glBindRenderbuffer( GL_RENDERBUFFER, 0 );
+
+        layer_t* layer = findLayer( mFrameID );
+        if( layer != nullptr ) {
+            layer->mResolveID = mResolveID;
+            layer->mRes = pFBRes;
+        }
+    } else {
+        glFramebufferTexture2D( GL_FRAMEBUFFER,
+            GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mColorID, 0 );
+
+        mDepthID = 0;
+        if( pFormat.mHasDepth ) {
+            glGenTextures( 1, &mDepthID );
+            glBindTexture( GL_TEXTURE_2D, mDepthID );
+            glTexImage2D( GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32, pFBRes.x, pFBRes.y,
+                0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, nullptr );
+            glFramebufferTexture2D( GL_FRAMEBUFFER,
+                GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, mDepthID, 0 );
+        }
+    }
 }
 
 
 fbo_t::~fbo_t() {
-    glBindFramebuffer( GL_FRAMEBUFFER, 0 );
-    glBindTexture( GL_TEXTURE_2D, 0 );
+    llce::gfx::state::framebuffer( 0 );
+    if( sSoft.mBackend == backend::gl ) {
+        glBindTexture( GL_TEXTURE_2D, 0 );
+    }
 }
 
 
 bool32_t fbo_t::valid() const {
-    return glCheckFramebufferStatus( GL_FRAMEBUFFER ) == GL_FRAMEBUFFER_COMPLETE;
+    if( sSoft.mBackend == backend::soft ) {
+        return softTarget( mFrameID ) != nullptr;
+    }
+
+    bool32_t isValid = glCheckFramebufferStatus( GL_FRAMEBUFFER ) == GL_FRAMEBUFFER_COMPLETE;
+    if( mResolveID != 0 ) {
+        glBindFramebuffer( GL_READ_FRAMEBUFFER, mResolveID );
+        isValid &= glCheckFramebufferStatus( GL_READ_FRAMEBUFFER ) == GL_FRAMEBUFFER_COMPLETE;
+        glBindFramebuffer( GL_READ_FRAMEBUFFER, sState.mFrameID );
+    }
+    return isValid;
 }
 
 /// 'llce::gfx::fbo_context_t' Functions ///
 
-fbo_context_t::fbo_context_t( const uint32_t pFBID, const vec2u32_t pFBRes ) {
-    const static int32_t csContextFlags[] = { GL_VIEWPORT, GL_SCISSOR_BOX };
-    const uint32_t cContextCount = LLCE_ELEM_COUNT( csContextFlags );
+fbo_context_t::fbo_context_t( const uint32_t pFBID, const vec2u32_t pFBRes, const uint64_t pContentKey ) :
+        mFrameID( sState.mFrameID ),
+        mViewport{ sState.mViewport[0], sState.mViewport[1] },
+        mScissor{ sState.mScissor[0], sState.mScissor[1] } {
+    llce::gfx::flush();
+    llce::gfx::mark( pass::layer, true );
+
+    const vec2i32_t cFBPos( 0, 0 ), cFBDims( pFBRes.x, pFBRes.y );
+    llce::gfx::state::framebuffer( pFBID );
+    llce::gfx::clear();
+
+    layer_t* layer = findLayer( pFBID );
+    if( layer != nullptr ) {
+        layer->mContentKey = pContentKey;
+        layer->mRes = pFBRes;
+    }
+    llce::gfx::state::viewport( cFBPos, cFBDims );
+    llce::gfx::state::scissor( cFBPos, cFBDims );
+}
+
+
+fbo_context_t::~fbo_context_t() {
+    llce::gfx::flush();
+    llce::gfx::resolve( sState.mFrameID );
+    llce::gfx::mark( pass::layer, false );
+
+    llce::gfx::state::framebuffer( mFrameID );
+    llce::gfx::state::viewport( mViewport[0], mViewport[1] );
+    llce::gfx::state::scissor( mScissor[0], mScissor[1] );
+}
+
+/// 'llce::gfx::list_t' Functions ///
+
+list_t::list_t( bit8_t* pBuffer, const uint64_t pBufferLength ) :
+        mBuffer( pBuffer ), mBufferLength( pBufferLength ), mPeakLength( 0 ) {
+    reset();
+}
+
 
-    vec2i32_t* cContextParams[] = { &mViewport[0], &mScissor[0] };
-    for( uint32_t contextIdx = 0; contextIdx < cContextCount; contextIdx++ ) {
-        glGetIntegerv( csContextFlags[contextIdx],
-            static_cast<int32_t*>(&(cContextParams[contextIdx]->x)) );
+void list_t::reset() {
+    mLength = 0;
+    mSpillCount = 0;
+    std::memset( &mCounts[0], 0, sizeof(mCounts) );
+}
+
+
+// NOTE(JRC): Keys are 64-bit FNV-1a hashes of the encoded commands. Lists that
+// spilled during recording were partially executed before they were complete,
+// so they can't be summarized by their remaining commands and are unkeyed.
+uint64_t list_t::key() const {
+    if( mSpillCount > 0 ) {
+        return CONTENT_UNKEYED;
     }
 
-    glBindFramebuffer( GL_FRAMEBUFFER, pFBID );
-    glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
-    glViewport( 0, 0, pFBRes.x, pFBRes.y );
-    glScissor( 0, 0, pFBRes.x, pFBRes.y );
+    uint64_t listKey = 0xcbf29ce484222325ULL;
+    for( uint64_t byteIdx = 0; byteIdx < mLength; byteIdx++ ) {
+        listKey = ( listKey ^ static_cast<uint8_t>(mBuffer[byteIdx]) ) * 0x100000001b3ULL;
+    }
+
+    return ( listKey != CONTENT_UNKEYED ) ? listKey : 0;
 }
 
+/// 'llce::gfx::state' Functions ///
 
-fbo_context_t::~fbo_context_t() {
-    glBindFramebuffer( GL_FRAMEBUFFER, 0 );
-    glViewport( mViewport[0].x, mViewport[0].y, mViewport[1].x, mViewport[1].y );
-    glScissor( mScissor[0].x, mScissor[0].y, mScissor[1].x, mScissor[1].y );
+const state_t& state::get() {
+    return sState;
+}
+
+
+void state::invalidate() {
+    sState.mStaleMask = all_stale;
+}
+
+
+void state::viewport( const vec2i32_t& pPos, const vec2i32_t& pDims ) {
+    if( (sState.mStaleMask & viewport_stale) || pPos != sState.mViewport[0] || pDims != sState.mViewport[1] ) {
+        if( sRecorder.mList != nullptr ) {
+            listRecord( command::viewport, pPos, pDims );
+        } else if( sSoft.mBackend == backend::gl ) {
+            glViewport( pPos.x, pPos.y, pDims.x, pDims.y );
+        }
+        sState.mViewport[0] = pPos;
+        sState.mViewport[1] = pDims;
+        sState.mStaleMask &= ~viewport_stale;
+    }
+}
+
+
+void state::scissor( const vec2i32_t& pPos, const vec2i32_t& pDims ) {
+    if( (sState.mStaleMask & scissor_stale) || pPos != sState.mScissor[0] || pDims != sState.mScissor[1] ) {
+        if( sRecorder.mList != nullptr ) {
+            listRecord( command::scissor, pPos, pDims );
+        } else if( sSoft.mBackend == backend::gl ) {
+            glScissor( pPos.x, pPos.y, pDims.x, pDims.y );
+        }
+        sState.mScissor[0] = pPos;
+        sState.mScissor[1] = pDims;
+        sState.mStaleMask &= ~scissor_stale;
+    }
+}
+
+
+void state::projection( const mat4f32_t& pMatrix ) {
+    if( (sState.mStaleMask & projection_stale) || pMatrix != sState.mProjection ) {
+        if( sRecorder.mList != nullptr ) {
+            listRecord( command::projection, pMatrix );
+        } else if( sSoft.mBackend == backend::gl ) {
+            glMatrixMode( GL_PROJECTION );
+            glLoadMatrixf( &pMatrix[0][0] );
+            glMatrixMode( GL_MODELVIEW );
+        }
+        sState.mProjection = pMatrix;
+        sState.mStaleMask &= ~projection_stale;
+    }
+}
+
+
+void state::modelview( const mat4f32_t& pMatrix ) {
+    if( (sState.mStaleMask & modelview_stale) || pMatrix != sState.mModelview ) {
+        if( sRecorder.mList != nullptr ) {
+            listRecord( command::modelview, pMatrix );
+        } else if( sSoft.mBackend == backend::gl ) {
+            glLoadMatrixf( &pMatrix[0][0] );
+        }
+        sState.mModelview = pMatrix;
+        sState.mStaleMask &= ~modelview_stale;
+    }
+}
+
+
+void state::framebuffer( const uint32_t pFBID ) {
+    if( (sState.mStaleMask & framebuffer_stale) || pFBID != sState.mFrameID ) {
+        if( sRecorder.mList != nullptr ) {
+            listRecord( command::framebuffer, pFBID );
+        } else if( sSoft.mBackend == backend::gl ) {
+            glBindFramebuffer( GL_FRAMEBUFFER, pFBID );
+        }
+        sState.mFrameID = pFBID;
+        sState.mStaleMask &= ~framebuffer_stale;
+    }
+}
+
+
+void state::color( const color4u8_t& pColor ) {
+    if( (sState.mStaleMask & color_stale) || pColor != sState.mColor ) {
+        if( sRecorder.mList != nullptr ) {
+            listRecord( command::color, pColor );
+        } else if( sSoft.mBackend == backend::gl ) {
+            glColor4ubv( (uint8_t*)&pColor );
+        }
+        sState.mColor = pColor;
+        sState.mStaleMask &= ~color_stale;
+    }
+}
+
+
+void state::window( const vec2i32_t& pDims ) {
+    sState.mWindowDims = pDims;
 }
 
 /// 'llce::gfx' General Functions ///
@@ -178,25 +1075,368 @@ float32_t aspect( const vec2f32_t& pDims ) {
 }
 
 
-mat4f32_t glMatrix() {
-    mat4f32_t mvMatrix( 0.0f );
-    glGetFloatv( GL_MODELVIEW_MATRIX, &mvMatrix[0][0] );
+void boot() {
+    if( sBatch.mAtlasTextureID != 0 || sSoft.mBackend == backend::soft ) {
+        return;
+    }
+
+    glGenTextures( 1, &sBatch.mAtlasTextureID );
+    glBindTexture( GL_TEXTURE_2D, sBatch.mAtlasTextureID );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+    glTexImage2D( GL_TEXTURE_2D, 0, GL_ALPHA8, atlas_t::WIDTH, atlas_t::HEIGHT,
+        0, GL_ALPHA, GL_UNSIGNED_BYTE, nullptr );
+
+    glPushClientAttrib( GL_CLIENT_PIXEL_STORE_BIT );
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+    for( uint32_t glyphIdx = 0; glyphIdx < 128; glyphIdx++ ) {
+        uint8_t glyphTexels[atlas_t::GLYPH_HEIGHT][atlas_t::GLYPH_WIDTH];
+        for( uint32_t texelY = 0; texelY < atlas_t::GLYPH_HEIGHT; texelY++ ) {
+            for( uint32_t texelX = 0; texelX < atlas_t::GLYPH_WIDTH; texelX++ ) {
+                const uint32_t cPixelX = texelX / atlas_t::PIXEL_TEXELS;
+                const uint32_t cPixelY = texelY / atlas_t::PIXEL_TEXELS;
+                const bool32_t cIsBorder =
+                    texelX % atlas_t::PIXEL_TEXELS == 0 || texelX % atlas_t::PIXEL_TEXELS == atlas_t::PIXEL_TEXELS - 1 ||
+                    texelY % atlas_t::PIXEL_TEXELS == 0 || texelY % atlas_t::PIXEL_TEXELS == atlas_t::PIXEL_TEXELS - 1;
+                const bool32_t cIsLit =
+                    ( llce::gfx::ASCII_DIGIT_MAP[glyphIdx][cPixelY] >> (DIGIT_WIDTH - 1 - cPixelX) ) & 1;
+                glyphTexels[texelY][texelX] = ( glyphIdx == 0 || (!cIsBorder && cIsLit) ) ? 0xff : 0x00;
+            }
+        }
+
+        glTexSubImage2D( GL_TEXTURE_2D, 0,
+            (glyphIdx % atlas_t::GLYPH_COLUMNS) * atlas_t::GLYPH_WIDTH,
+            (glyphIdx / atlas_t::GLYPH_COLUMNS) * atlas_t::GLYPH_HEIGHT,
+            atlas_t::GLYPH_WIDTH, atlas_t::GLYPH_HEIGHT,
+            GL_ALPHA, GL_UNSIGNED_BYTE, &glyphTexels[0][0] );
+    }
+    glPopClientAttrib();
+
+    glBindTexture( GL_TEXTURE_2D, 0 );
+}
+
+
+void flush() {
+    if( sBatch.mVertexCount == 0 ) {
+        return;
+    }
+
+    // NOTE(JRC): Batched vertices are already in context space, so the software
+    // backend only applies the shadowed modelview/projection/viewport transforms (as
+    // OpenGL would) before snapping them to fixed point. Primitives are flat shaded
+    // and untextured (text is emitted as rectangles for this backend), and the two
+    // triangles of each axis-aligned quad are filled as a single rectangle.
+    if( sSoft.mBackend == backend::soft ) {
+        if( softTarget(sState.mFrameID) != nullptr ) {
+            const vec2i32_t& cVPCoords = sState.mViewport[0];
+            const vec2i32_t& cVPRes = sState.mViewport[1];
+            const mat4f32_t cMatrix = sState.mProjection * sState.mModelview;
+            const auto cFix = [&] ( const vec2f32_t& pPos ) {
+                const vec4f32_t cNDCPos = cMatrix * vec4f32_t( pPos.x, pPos.y, 0.0f, 1.0f );
+                const vec2f32_t cWindowPos(
+                    cVPCoords.x + ( cNDCPos.x / cNDCPos.w + 1.0f ) * cVPRes.x / 2.0f,
+                    cVPCoords.y + ( cNDCPos.y / cNDCPos.w + 1.0f ) * cVPRes.y / 2.0f );
+                return vec2i32_t(
+                    std::lround(cWindowPos.x * raster_t::SUBPIXEL_ONE),
+                    std::lround(cWindowPos.y * raster_t::SUBPIXEL_ONE) );
+            };
+
+            command_t command = softCommand( command_t::triangle_type, sState.mColor );
+            for( uint32_t vertexIdx = 0; vertexIdx + 3 <= sBatch.mVertexCount; ) {
+                const vertex_t* cVertices = &sBatch.mVertices[vertexIdx];
+                command.mColor = cVertices[0].mColor;
+                command.mVertices[0] = cFix( cVertices[0].mPos );
+                command.mVertices[1] = cFix( cVertices[1].mPos );
+                command.mVertices[2] = cFix( cVertices[2].mPos );
+
+                if( vertexIdx + 6 <= sBatch.mVertexCount &&
+                        cVertices[3].mPos == cVertices[0].mPos && cVertices[4].mPos == cVertices[2].mPos &&
+                        cVertices[3].mColor == cVertices[0].mColor ) {
+                    const vec2i32_t& cA = command.mVertices[0], & cB = command.mVertices[1], & cC = command.mVertices[2];
+                    const vec2i32_t cD = cFix( cVertices[5].mPos );
+                    if( (cA.x == cB.x && cB.y == cC.y && cC.x == cD.x && cD.y == cA.y) ||
+                            (cA.y == cB.y && cB.x == cC.x && cC.y == cD.y && cD.x == cA.x) ) {
+                        command.mType = command_t::fill_type;
+                        command.mVertices[1] = cC;
+                        softRecord( sState.mFrameID, command );
+                        vertexIdx += 6;
+                        continue;
+                    }
+                }
 
-    mat4f32_t projMatrix( 0.0f );
-    glGetFloatv( GL_PROJECTION_MATRIX, &projMatrix[0][0] );
+                command.mType = command_t::triangle_type;
+                softRecord( sState.mFrameID, command );
+                vertexIdx += 3;
+            }
+        }
+
+        sBatch.mVertexCount = 0;
+        return;
+    }
+
+    if( sBatch.mVertexBufferID == 0 ) {
+        glGenBuffers( 1, &sBatch.mVertexBufferID );
+    }
+
+    // NOTE(JRC): The buffer's storage is orphaned before each upload so that
+    // the driver can allocate fresh memory instead of stalling on prior draws.
+    glBindBuffer( GL_ARRAY_BUFFER, sBatch.mVertexBufferID );
+    glBufferData( GL_ARRAY_BUFFER, sizeof(sBatch.mVertices), nullptr, GL_STREAM_DRAW );
+    glBufferSubData( GL_ARRAY_BUFFER, 0, sBatch.mVertexCount * sizeof(vertex_t), &sBatch.mVertices[0] );
+
+    glPushAttrib( GL_ENABLE_BIT | GL_TEXTURE_BIT );
+    glEnable( GL_TEXTURE_2D );
+    glBindTexture( GL_TEXTURE_2D, sBatch.mAtlasTextureID );
+
+    glPushClientAttrib( GL_CLIENT_VERTEX_ARRAY_BIT );
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+    glEnableClientState( GL_COLOR_ARRAY );
+    glVertexPointer( 2, GL_FLOAT, sizeof(vertex_t), (void*)offsetof(vertex_t, mPos) );
+    glTexCoordPointer( 2, GL_FLOAT, sizeof(vertex_t), (void*)offsetof(vertex_t, mUV) );
+    glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(vertex_t), (void*)offsetof(vertex_t, mColor) );
+    glDrawArrays( GL_TRIANGLES, 0, sBatch.mVertexCount );
+    glPopClientAttrib();
+    glPopAttrib();
+    // NOTE(JRC): The current color is undefined after drawing with a color array.
+    sState.mStaleMask |= color_stale;
+
+    glBindBuffer( GL_ARRAY_BUFFER, 0 );
+    sBatch.mVertexCount = 0;
+}
+
+
+void finish() {
+    llce::gfx::flush();
+    if( sSoft.mBackend == backend::soft ) {
+        softResolve();
+    }
+}
+
+
+void record( list_t* pList ) {
+    llce::gfx::flush();
+
+    if( pList != nullptr && sRecorder.mList == nullptr ) {
+        sRecorder.mState = sState;
+        sState.mStaleMask = all_stale;
+    } else if( pList == nullptr && sRecorder.mList != nullptr ) {
+        sState = sRecorder.mState;
+    }
+
+    if( pList != nullptr ) {
+        pList->reset();
+    }
+    sRecorder.mList = pList;
+}
+
+
+void execute( const list_t& pList ) {
+    LLCE_CHECK_ERROR( sRecorder.mList == nullptr,
+        "Unable to execute command list; command lists can't be executed while recording." );
+    LLCE_CHECK_ERROR( sBatch.mMatrixDepth + 1 < batch_t::MAX_DEPTH && sBatch.mColorDepth + 1 < batch_t::MAX_DEPTH,
+        "Unable to execute command list; maximum context depth of " <<
+        batch_t::MAX_DEPTH << " exceeded." );
+
+    // NOTE(JRC): Recorded polygons are already transformed, so they're emitted
+    // within an identity context that's updated with the color of each polygon.
+    sBatch.mMatrices[++sBatch.mMatrixDepth] = mat4f32_t( 1.0f );
+    sBatch.mColorDepth++;
+
+    for( uint64_t listOffset = 0; listOffset < pList.mLength; ) {
+        const entry_t* cEntry = (const entry_t*)&pList.mBuffer[listOffset];
+        const bit8_t* cPayload = (const bit8_t*)( cEntry + 1 );
+        listOffset += cEntry->mLength;
+
+        if( cEntry->mType == command::polygon ) {
+            sBatch.mColors[sBatch.mColorDepth] = listRead<color4u8_t>( cPayload );
+            const vec2f32_t* cVertices = (const vec2f32_t*)cPayload;
+            llce::gfx::emit( cVertices, cEntry->mCount, cEntry->mFlags ? cVertices + cEntry->mCount : nullptr );
+        } else if( cEntry->mType == command::clear ) {
+            llce::gfx::flush();
+            llce::gfx::clear();
+        } else if( cEntry->mType == command::resolve ) {
+            llce::gfx::flush();
+            llce::gfx::resolve( listRead<uint32_t>(cPayload) );
+        } else if( cEntry->mType == command::blit ) {
+            const uint32_t cSrcFBID = listRead<uint32_t>( cPayload );
+            const vec2u32_t cSrcRes = listRead<vec2u32_t>( cPayload );
+            llce::gfx::blit( cSrcFBID, cSrcRes, listRead<box_t>(cPayload) );
+        } else if( cEntry->mType == command::framebuffer ) {
+            llce::gfx::flush();
+            llce::gfx::state::framebuffer( listRead<uint32_t>(cPayload) );
+        } else if( cEntry->mType == command::viewport || cEntry->mType == command::scissor ) {
+            llce::gfx::flush();
+            const vec2i32_t cPos = listRead<vec2i32_t>( cPayload );
+            const vec2i32_t cDims = listRead<vec2i32_t>( cPayload );
+            if( cEntry->mType == command::viewport ) {
+                llce::gfx::state::viewport( cPos, cDims );
+            } else {
+                llce::gfx::state::scissor( cPos, cDims );
+            }
+        } else if( cEntry->mType == command::projection ) {
+            llce::gfx::flush();
+            llce::gfx::state::projection( listRead<mat4f32_t>(cPayload) );
+        } else if( cEntry->mType == command::modelview ) {
+            llce::gfx::flush();
+            llce::gfx::state::modelview( listRead<mat4f32_t>(cPayload) );
+        } else if( cEntry->mType == command::color ) {
+            llce::gfx::state::color( listRead<color4u8_t>(cPayload) );
+        } else if( cEntry->mType == command::timestamp ) {
+            const pass_e cPass = listRead<pass_e>( cPayload );
+            llce::gfx::mark( cPass, listRead<bool32_t>(cPayload) );
+        }
+    }
+    llce::gfx::flush();
+
+    sBatch.mColorDepth--;
+    sBatch.mMatrixDepth--;
+}
+
+
+void profile( const bool32_t pIsProfiling ) {
+    if( sProfile.mIsProfiling == pIsProfiling || sSoft.mBackend == backend::soft ) {
+        return;
+    }
+
+    uint32_t* queryIDs = &sProfile.mTimings[0][0].mQueryIDs[0];
+    const uint32_t cQueryStride = sizeof( timing_t ) / sizeof( uint32_t );
+    for( uint32_t timingIdx = 0; timingIdx < profile_t::MAX_FRAMES * profile_t::MAX_TIMINGS; timingIdx++ ) {
+        uint32_t* timingQueryIDs = queryIDs + timingIdx * cQueryStride;
+        if( pIsProfiling ) {
+            glGenQueries( 2, timingQueryIDs );
+        } else {
+            glDeleteQueries( 2, timingQueryIDs );
+        }
+    }
+
+    std::fill_n( &sProfile.mTimingCounts[0], profile_t::MAX_FRAMES, 0 );
+    sProfile.mFrameIdx = 0;
+    sProfile.mTimingDepth = 0;
+    sProfile.mIsProfiling = pIsProfiling;
+}
 
-    vec2u32_t vpCoords, vpRes; {
-        int32_t viewParams[4];
-        glGetIntegerv( GL_VIEWPORT, &viewParams[0] );
-        vpCoords = { static_cast<uint32_t>(viewParams[0]), static_cast<uint32_t>(viewParams[1]) };
-        vpRes = { static_cast<uint32_t>(viewParams[2]), static_cast<uint32_t>(viewParams[3]) };
+
+// NOTE(JRC): This function ends the current frame's timings, so it should be
+// called exactly once per frame (e.g. after the frame's buffers are swapped). The
+// reported times are those of the oldest frame in the ring, and 'false' is
+// returned if no times are available for that frame. Timer contexts can't span
+// frames, so any that are still open at this point are abandoned.
+bool32_t timings( float64_t (&pPassSecs)[pass::_length] ) {
+    std::fill_n( &pPassSecs[0], pass::_length, 0.0 );
+    if( !sProfile.mIsProfiling ) {
+        return false;
+    }
+
+    sProfile.mFrameIdx = ( sProfile.mFrameIdx + 1 ) % profile_t::MAX_FRAMES;
+    sProfile.mTimingDepth = 0;
+    uint32_t& timingCount = sProfile.mTimingCounts[sProfile.mFrameIdx];
+    const timing_t* cTimings = &sProfile.mTimings[sProfile.mFrameIdx][0];
+
+    bool32_t isAvailable = timingCount > 0;
+    for( uint32_t timingIdx = 0; timingIdx < timingCount && isAvailable; timingIdx++ ) {
+        GLint queryAvailable = GL_FALSE;
+        glGetQueryObjectiv( cTimings[timingIdx].mQueryIDs[1], GL_QUERY_RESULT_AVAILABLE, &queryAvailable );
+        isAvailable &= queryAvailable == GL_TRUE;
+    }
+
+    for( uint32_t timingIdx = 0; timingIdx < timingCount && isAvailable; timingIdx++ ) {
+        GLuint64 queryTimes[2] = { 0, 0 };
+        glGetQueryObjectui64v( cTimings[timingIdx].mQueryIDs[0], GL_QUERY_RESULT, &queryTimes[0] );
+        glGetQueryObjectui64v( cTimings[timingIdx].mQueryIDs[1], GL_QUERY_RESULT, &queryTimes[1] );
+        pPassSecs[cTimings[timingIdx].mPass] += 1.0e-9 * ( queryTimes[1] - queryTimes[0] );
     }
 
+    timingCount = 0;
+    return isAvailable;
+}
+
+
+void select( const backend_e pBackend ) {
+    llce::gfx::finish();
+    sSoft.mBackend = pBackend;
+    llce::gfx::state::invalidate();
+}
+
+
+backend_e active() {
+    return sSoft.mBackend;
+}
+
+
+const raster_t* raster( const uint32_t pFBID ) {
+    llce::gfx::finish();
+
+    const target_t* cTarget = softTarget( pFBID );
+    return ( cTarget != nullptr ) ? &cTarget->mRaster : nullptr;
+}
+
+
+// NOTE(JRC): The destination box is relative to the current viewport. Only color
+// is copied since no frame buffer's depth is ever sampled after it's rendered.
+void blit( const uint32_t pSrcFBID, const vec2u32_t& pSrcRes, const box_t& pDstBox ) {
+    if( sRecorder.mList != nullptr ) {
+        listRecord( command::blit, pSrcFBID, pSrcRes, pDstBox );
+        return;
+    }
+
+    llce::gfx::flush();
+
+    const vec2i32_t& cVPCoords = sState.mViewport[0];
+    const vec2i32_t& cVPRes = sState.mViewport[1];
+    const vec2i32_t cDstMin(
+        cVPCoords.x + pDstBox.min().x * cVPRes.x, cVPCoords.y + pDstBox.min().y * cVPRes.y );
+    const vec2i32_t cDstMax(
+        cVPCoords.x + pDstBox.max().x * cVPRes.x, cVPCoords.y + pDstBox.max().y * cVPRes.y );
+
+    if( sSoft.mBackend == backend::soft ) {
+        target_t* source = softTarget( pSrcFBID );
+        if( softTarget(sState.mFrameID) != nullptr && source != nullptr ) {
+            command_t command = softCommand( command_t::blit_type, sState.mColor );
+            command.mSourceID = pSrcFBID;
+            command.mVertices[0] = cDstMin;
+            command.mVertices[1] = cDstMax - cDstMin;
+            command.mVertices[2] = vec2i32_t( pSrcRes.x, pSrcRes.y );
+            softRecord( sState.mFrameID, command );
+            source->mIsSourced |= pSrcFBID != sState.mFrameID;
+        }
+    } else {
+        // NOTE(JRC): Multisampled frame buffers are read via their resolved
+        // counterparts, which allows them to be blitted at any scale.
+        const layer_t* cSource = findLayer( pSrcFBID );
+        llce::gfx::timer_context_t blitTC( pass::composite );
+        glBindFramebuffer( GL_READ_FRAMEBUFFER,
+            (cSource != nullptr && cSource->mResolveID != 0) ? cSource->mResolveID : pSrcFBID );
+        glBlitFramebuffer( 0, 0, pSrcRes.x, pSrcRes.y, cDstMin.x, cDstMin.y, cDstMax.x, cDstMax.y,
+            GL_COLOR_BUFFER_BIT, GL_LINEAR );
+        // NOTE(JRC): The read binding is restored so that it agrees with the
+        // framebuffer state shadowed by 'llce::gfx' (see 'llce::gfx::state').
+        glBindFramebuffer( GL_READ_FRAMEBUFFER, sState.mFrameID );
+    }
+}
+
+
+bool32_t stale( const uint32_t pFBID, const vec2u32_t& pFBRes, const uint64_t pContentKey ) {
+    const layer_t* cLayer = findLayer( pFBID );
+    return pContentKey == CONTENT_UNKEYED || cLayer == nullptr ||
+        cLayer->mContentKey != pContentKey || cLayer->mRes != pFBRes;
+}
+
+
+mat4f32_t glMatrix() {
+    const mat4f32_t cMVMatrix = sState.mModelview * sBatch.mMatrices[sBatch.mMatrixDepth];
+    const mat4f32_t& cProjMatrix = sState.mProjection;
+
+    const vec2i32_t& cVPCoords = sState.mViewport[0];
+    const vec2i32_t& cVPRes = sState.mViewport[1];
+
     mat4f32_t vpMatrix( 1.0f );
-    vpMatrix = glm::translate( vpMatrix, vec3f32_t((vpCoords.x + vpRes.x) / 2.0f, (vpCoords.y + vpRes.y) / 2.0f, 0.5f) );
-    vpMatrix = glm::scale( vpMatrix, vec3f32_t(vpRes.x / 2.0f, vpRes.y / 2.0f, 0.5f) );
+    vpMatrix = glm::translate( vpMatrix, vec3f32_t((cVPCoords.x + cVPRes.x) / 2.0f, (cVPCoords.y + cVPRes.y) / 2.0f, 0.5f) );
+    vpMatrix = glm::scale( vpMatrix, vec3f32_t(cVPRes.x / 2.0f, cVPRes.y / 2.0f, 0.5f) );
 
-    return vpMatrix * projMatrix * mvMatrix;
+    return vpMatrix * cProjMatrix * cMVMatrix;
 }
 
 
@@ -311,28 +1551,27 @@ void render::vector( const vec2f32_t& pOrigin, const vec2f32_t& pDir, const floa
     const vec2f32_t cDirNorm = glm::normalize( pDir );
     const float32_t cDirAngle = glm::orientedAngle( csAxisI, cDirNorm );
 
-    glPushMatrix();
     mat4f32_t matVecSpace( 1.0f );
     matVecSpace *= glm::translate( vec3f32_t(pOrigin.x, pOrigin.y, 0.0f) );
     matVecSpace *= glm::rotate( cDirAngle, vec3f32_t(0.0f, 0.0f, 1.0f) );
-    glMultMatrixf( &matVecSpace[0][0] );
+    pushMatrix( matVecSpace );
 
     { // Rendering //
-        glBegin( GL_QUADS ); {
-            glVertex2f( 0.0f, (-csWidthRatio / 2.0f) * pLength );
-            glVertex2f( csTailRatio * pLength, (-csWidthRatio / 2.0f) * pLength );
-            glVertex2f( csTailRatio * pLength, (csWidthRatio / 2.0f) * pLength );
-            glVertex2f( 0.0f, (csWidthRatio / 2.0f) * pLength );
-        } glEnd();
-
-        glBegin( GL_TRIANGLES ); {
-            glVertex2f( csTailRatio * pLength, (-csHeadRatio / 2.0f) * pLength );
-            glVertex2f( (csTailRatio + csHeadRatio) * pLength, 0.0f );
-            glVertex2f( csTailRatio * pLength, (csHeadRatio / 2.0f) * pLength );
-        } glEnd();
+        const vec2f32_t cTailVertices[] = {
+            { 0.0f, (-csWidthRatio / 2.0f) * pLength },
+            { csTailRatio * pLength, (-csWidthRatio / 2.0f) * pLength },
+            { csTailRatio * pLength, (csWidthRatio / 2.0f) * pLength },
+            { 0.0f, (csWidthRatio / 2.0f) * pLength } };
+        emit( &cTailVertices[0], LLCE_ELEM_COUNT(cTailVertices) );
+
+        const vec2f32_t cHeadVertices[] = {
+            { csTailRatio * pLength, (-csHeadRatio / 2.0f) * pLength },
+            { (csTailRatio + csHeadRatio) * pLength, 0.0f },
+            { csTailRatio * pLength, (csHeadRatio / 2.0f) * pLength } };
+        emit( &cHeadVertices[0], LLCE_ELEM_COUNT(cHeadVertices) );
     }
-    
-    glPopMatrix();
+
+    popMatrix();
 }
 
 
@@ -340,12 +1579,12 @@ void render::box( const box_t& pBox ) {
     const vec2f32_t& boxMin = pBox.mPos;
     const vec2f32_t& boxDims = pBox.mDims;
 
-    glBegin( GL_QUADS ); {
-        glVertex2f( boxMin.x, boxMin.y );
-        glVertex2f( boxMin.x + boxDims.x, boxMin.y );
-        glVertex2f( boxMin.x + boxDims.x, boxMin.y + boxDims.y );
-        glVertex2f( boxMin.x, boxMin.y + boxDims.y );
-    } glEnd();
+    const vec2f32_t cBoxVertices[] = {
+        { boxMin.x, boxMin.y },
+        { boxMin.x + boxDims.x, boxMin.y },
+        { boxMin.x + boxDims.x, boxMin.y + boxDims.y },
+        { boxMin.x, boxMin.y + boxDims.y } };
+    emit( &cBoxVertices[0], LLCE_ELEM_COUNT(cBoxVertices) );
 }
 
 
@@ -392,29 +1631,34 @@ void render::box( const vec2f32_t& pSize, const vec2f32_t& pPos, const llce::geo
 
 
 void render::circle( const circle_t& pCircle, const float32_t pStartRadians, const float32_t pEndRadians ) {
+    // NOTE(JRC): The maximum segment count is 'ceil(2pi * csSegmentsPer2PI)' (the
+    // truncation below is offset by one since this product is never integral), so
+    // full circles keep all of their segments and only intervals that wrap around
+    // more than once are clamped to fit the vertex array.
     const static uint32_t csSegmentsPer2PI = 20;
+    const static uint32_t csSegmentsMax = static_cast<uint32_t>( 2.0 * M_PI * csSegmentsPer2PI ) + 1;
 
-    glPushMatrix();
     mat4f32_t matCircleSpace( 1.0f );
     matCircleSpace *= glm::translate( vec3f32_t(pCircle.mCenter.x, pCircle.mCenter.y, 0.0f) );
     matCircleSpace *= glm::scale( vec3f32_t(pCircle.mRadius / 2.0f, pCircle.mRadius / 2.0f, 1.0f) );
-    glMultMatrixf( &matCircleSpace[0][0] );
+    pushMatrix( matCircleSpace );
 
     // FIXME(JRC): The following code crashes for very small intervals as they cause
     // the interpolation scheme to divide by zero.
     { // Rendering //
         const interval_t cRadianInterval( pStartRadians, pEndRadians );
-        const uint32_t cSegmentCount = std::ceil( cRadianInterval.length() * csSegmentsPer2PI );
-        glBegin( GL_TRIANGLE_FAN ); {
-            glVertex2f( 0.0f, 0.0f );
-            for( uint32_t segmentIdx = 0; segmentIdx < cSegmentCount; segmentIdx++ ) {
-                float32_t segmentRadians = cRadianInterval.interp( segmentIdx / (cSegmentCount - 1.0f) );
-                glVertex2f( std::cos(segmentRadians), std::sin(segmentRadians) );
-            }
-        } glEnd();
+        const uint32_t cSegmentCount = glm::min( csSegmentsMax,
+            static_cast<uint32_t>(std::ceil(cRadianInterval.length() * csSegmentsPer2PI)) );
+
+        vec2f32_t circleVertices[csSegmentsMax + 1] = { vec2f32_t(0.0f, 0.0f) };
+        for( uint32_t segmentIdx = 0; segmentIdx < cSegmentCount; segmentIdx++ ) {
+            float32_t segmentRadians = cRadianInterval.interp( segmentIdx / (cSegmentCount - 1.0f) );
+            circleVertices[segmentIdx + 1] = { std::cos(segmentRadians), std::sin(segmentRadians) };
+        }
+        emit( &circleVertices[0], cSegmentCount + 1 );
     }
 
-    glPopMatrix();
+    popMatrix();
 }
 
 
@@ -425,22 +1669,19 @@ void render::border( const float32_t pSize, const uint32_t pDim ) {
         ( pDim == 1 ) ? pSize : pSize * cContextAspect
     );
 
-    glPushMatrix();
+    pushMatrix( mat4f32_t(1.0f) );
     mat4f32_t borderSpace( 1.0f );
     for( uint32_t sideIdx = 0; sideIdx < 4; sideIdx++ ) {
         borderSpace = glm::translate( vec3f32_t(0.0f, 1.0f, 0.0f) ) *
             glm::rotate( -glm::half_pi<float32_t>(), vec3f32_t(0.0f, 0.0f, 1.0f) );
-        glMultMatrixf( &borderSpace[0][0] );
+        sBatch.mMatrices[sBatch.mMatrixDepth] *= borderSpace;
 
         const float32_t cSideSize = ( sideIdx % 2 == 0 ) ? cSideSizes.y : cSideSizes.x;
-        glBegin( GL_QUADS ); {
-            glVertex2f( 0.0f, 0.0f );
-            glVertex2f( 0.0f, 1.0f );
-            glVertex2f( cSideSize, 1.0f );
-            glVertex2f( cSideSize, 0.0f );
-        } glEnd();
+        const vec2f32_t cSideVertices[] = {
+            { 0.0f, 0.0f }, { 0.0f, 1.0f }, { cSideSize, 1.0f }, { cSideSize, 0.0f } };
+        emit( &cSideVertices[0], LLCE_ELEM_COUNT(cSideVertices) );
     }
-    glPopMatrix();
+    popMatrix();
 }
 
 
@@ -450,33 +1691,23 @@ void render::border( const float32_t (&pSizes)[4] ) {
     // different index spaces.
     const static uint32_t csBorderIndexMap[] = { 2, 1, 0, 3 };
 
-    glPushMatrix();
+    pushMatrix( mat4f32_t(1.0f) );
     mat4f32_t borderSpace( 1.0f );
     for( uint32_t sideIdx = 0; sideIdx < 4; sideIdx++ ) {
         borderSpace = glm::translate( vec3f32_t(0.0f, 1.0f, 0.0f) ) *
             glm::rotate( -glm::half_pi<float32_t>(), vec3f32_t(0.0f, 0.0f, 1.0f) );
-        glMultMatrixf( &borderSpace[0][0] );
+        sBatch.mMatrices[sBatch.mMatrixDepth] *= borderSpace;
 
         const float32_t& cSideSize = pSizes[csBorderIndexMap[sideIdx]];
-        glBegin( GL_QUADS ); {
-            glVertex2f( 0.0f, 0.0f );
-            glVertex2f( 0.0f, 1.0f );
-            glVertex2f( cSideSize, 1.0f );
-            glVertex2f( cSideSize, 0.0f );
-        } glEnd();
+        const vec2f32_t cSideVertices[] = {
+            { 0.0f, 0.0f }, { 0.0f, 1.0f }, { cSideSize, 1.0f }, { cSideSize, 0.0f } };
+        emit( &cSideVertices[0], LLCE_ELEM_COUNT(cSideVertices) );
     }
-    glPopMatrix();
+    popMatrix();
 }
 
 
 void render::text( const char8_t* pText, const box_t& pRenderBox ) {
-    const static float64_t csDigitSpaceX = 1.0 / llce::gfx::DIGIT_WIDTH;
-    const static float64_t csDigitSpaceY = 1.0 / llce::gfx::DIGIT_HEIGHT;
-    const static float64_t csDigitPaddingX = csDigitSpaceX / 10.0;
-    const static float64_t csDigitPaddingY = csDigitSpaceY / 10.0;
-    const static float64_t csDigitFillX = csDigitSpaceX - 2.0 * csDigitPaddingX;
-    const static float64_t csDigitFillY = csDigitSpaceY - 2.0 * csDigitPaddingY;
-
     const uint32_t cTextLength = std::strlen( pText );
     const float64_t cTextSpacingX = 2.0 * llce::gfx::DIGIT_WIDTH;
     const float64_t cTextSpacingY = 0.0;
@@ -485,25 +1716,46 @@ void render::text( const char8_t* pText, const box_t& pRenderBox ) {
 
     gfx::render_context_t rrc( pRenderBox, llce::gfx::DIGIT_ASPECT * cTextLength );
     for( const char8_t* pTextItr = pText; *pTextItr != '\0'; pTextItr++ ) {
-        const auto cTextDigitMap = &llce::gfx::ASCII_DIGIT_MAP[static_cast<uint32_t>(*pTextItr)][0];
+        const uint32_t cTextChar = static_cast<uint32_t>( *pTextItr ) & 0x7F;
         const uint32_t cTextIdx = pTextItr - pText;
 
         const float64_t cTextOffsetX = ( cTextFillX + cTextFillX / cTextSpacingX ) * cTextIdx;
         const float64_t cTextOffsetY = 0.0;
 
-        const box_t cTextBox( cTextOffsetX, cTextOffsetY, cTextFillX, cTextFillY );
-        gfx::render_context_t trc( cTextBox );
-        for( uint32_t yIdx = 0; yIdx < llce::gfx::DIGIT_HEIGHT; yIdx++ ) {
-            for( uint32_t xIdx = 0; xIdx < llce::gfx::DIGIT_WIDTH; xIdx++ ) {
-                const float64_t cDigitOffsetX = csDigitPaddingX + csDigitSpaceX * xIdx;
-                const float64_t cDigitOffsetY = csDigitPaddingY + csDigitSpaceY * yIdx;
-
-                if( cTextDigitMap[yIdx][xIdx] ) {
-                    gfx::render::box( box_t(
-                        cDigitOffsetX, cDigitOffsetY, csDigitFillX, csDigitFillY) );
-                }
+        const vec2f32_t cTextMin( cTextOffsetX, cTextOffsetY );
+        const vec2f32_t cTextMax( cTextOffsetX + cTextFillX, cTextOffsetY + cTextFillY );
+
+        // NOTE(JRC): Without an atlas (i.e. before 'llce::gfx::boot' or with the
+        // software backend), glyphs are drawn untextured from their rectangle covers.
+        if( sBatch.mAtlasTextureID == 0 || sSoft.mBackend == backend::soft ) {
+            const vec2f32_t cPixelDims(
+                cTextFillX / llce::gfx::DIGIT_WIDTH, cTextFillY / llce::gfx::DIGIT_HEIGHT );
+            const glyph_t& cGlyph = llce::gfx::ASCII_GLYPH_MAP[cTextChar];
+            for( uint32_t rectIdx = 0; rectIdx < cGlyph.mRectCount; rectIdx++ ) {
+                const uint8_t (&cRect)[4] = cGlyph.mRects[rectIdx];
+                const vec2f32_t cRectMin( cTextMin.x + cPixelDims.x * cRect[0], cTextMin.y + cPixelDims.y * cRect[1] );
+                const vec2f32_t cRectMax( cRectMin.x + cPixelDims.x * cRect[2], cRectMin.y + cPixelDims.y * cRect[3] );
+                const vec2f32_t cRectVertices[] = {
+                    { cRectMin.x, cRectMin.y }, { cRectMax.x, cRectMin.y },
+                    { cRectMax.x, cRectMax.y }, { cRectMin.x, cRectMax.y } };
+                emit( &cRectVertices[0], LLCE_ELEM_COUNT(cRectVertices) );
             }
+            continue;
         }
+
+        const vec2f32_t cTextVertices[] = {
+            { cTextMin.x, cTextMin.y }, { cTextMax.x, cTextMin.y },
+            { cTextMax.x, cTextMax.y }, { cTextMin.x, cTextMax.y } };
+
+        const vec2f32_t cGlyphMin(
+            (cTextChar % atlas_t::GLYPH_COLUMNS) * atlas_t::GLYPH_U,
+            (cTextChar / atlas_t::GLYPH_COLUMNS) * atlas_t::GLYPH_V );
+        const vec2f32_t cGlyphMax( cGlyphMin.x + atlas_t::GLYPH_U, cGlyphMin.y + atlas_t::GLYPH_V );
+        const vec2f32_t cGlyphUVs[] = {
+            { cGlyphMin.x, cGlyphMin.y }, { cGlyphMax.x, cGlyphMin.y },
+            { cGlyphMax.x, cGlyphMax.y }, { cGlyphMin.x, cGlyphMax.y } };
+
+        emit( &cTextVertices[0], LLCE_ELEM_COUNT(cTextVertices), &cGlyphUVs[0] );
     }
 }
 
@@ -521,15 +1773,11 @@ void render::text( const char8_t* pText, const float32_t pSize, const vec2f32_t&
     // TODO(JRC): This should be adjusted based on the target aspect ratio for the
     // current simulation once the harness is updated to recognize/adapt to this value
     // (see 'hmp' issue #75). Currently, the harness always assumes/uses a 1:1 ratio.
-    vec2i32_t windowDims; {
-        SDL_Window* window = SDL_GL_GetCurrentWindow();
-        SDL_GetWindowSize( window, &windowDims.x, &windowDims.y );
+    vec2i32_t windowDims = sState.mWindowDims; {
         windowDims.x = windowDims.y = glm::min( windowDims.x, windowDims.y );
     } const vec2i32_t cWindowDims = windowDims;
 
-    vec4i32_t viewportData; {
-        glGetIntegerv( GL_VIEWPORT, &viewportData.x );
-    } const vec2i32_t cViewportDims = { viewportData.z, viewportData.w };
+    const vec2i32_t& cViewportDims = sState.mViewport[1];
 
     float32_t viewportWindowRatio = 1.0f; {
         const float32_t viewportAspect = llce::gfx::aspect( cViewportDims );
@@ -558,137 +1806,187 @@ void render::text( const char8_t* pText, const float32_t pSize, const vec2f32_t&
 
 /// 'llce::gfx' Constants ///
 
-const bool8_t ASCII_DIGIT_MAP[128][DIGIT_HEIGHT][DIGIT_WIDTH] = {
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'NUL'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'SOH'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'STX'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'ETX'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'EOT'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'ENQ'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'ACK'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'BEL'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'BS'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'TAB'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'LF'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'VT'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'FF'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'CR'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'SO'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'SI'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'DLE'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'DC1'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'DC2'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'DC3'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'DC4'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'NAK'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'SYN'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'ETB'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'CAN'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'EM'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'SUB'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'ESC'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'FS'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'GS'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'RS'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'US'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // ' '
-    { {0, 1, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 0, 0, 0}, {0, 1, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 1, 1, 0, 0} }, // '!'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '"'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '#'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '$'
-    { {1, 0, 0, 1, 1}, {1, 0, 0, 1, 1}, {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 1, 0}, {1, 1, 0, 0, 1}, {1, 1, 0, 0, 1} }, // '%'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '&'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '''
-    { {0, 0, 0, 1, 0}, {0, 0, 1, 0, 0}, {0, 1, 0, 0, 0}, {0, 1, 0, 0, 0}, {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 1, 0} }, // '('
-    { {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 1, 0}, {0, 0, 0, 1, 0}, {0, 0, 0, 1, 0}, {0, 0, 1, 0, 0}, {0, 1, 0, 0, 0} }, // ')'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '*'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '+'
-    { {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // ','
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '-'
-    { {0, 0, 0, 0, 0}, {0, 1, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '.'
-    { {1, 1, 0, 0, 0}, {1, 1, 0, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 1, 0}, {0, 0, 0, 1, 1}, {0, 0, 0, 1, 1} }, // '/'
-    { {0, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 1, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {0, 1, 1, 1, 0} }, // '0'
-    { {1, 1, 1, 1, 1}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {1, 0, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 1, 0, 0} }, // '1'
-    { {1, 1, 1, 1, 1}, {1, 0, 0, 0, 0}, {0, 1, 0, 0, 0}, {0, 0, 1, 1, 0}, {0, 0, 0, 0, 1}, {0, 0, 0, 0, 1}, {1, 1, 1, 1, 0} }, // '2'
-    { {1, 1, 1, 1, 0}, {0, 0, 0, 0, 1}, {0, 0, 0, 0, 1}, {0, 1, 1, 1, 0}, {0, 0, 0, 0, 1}, {0, 0, 0, 0, 1}, {1, 1, 1, 1, 0} }, // '3'
-    { {0, 0, 0, 0, 1}, {0, 0, 0, 0, 1}, {1, 1, 1, 1, 1}, {0, 1, 0, 0, 1}, {0, 0, 1, 0, 1}, {0, 0, 0, 1, 1}, {0, 0, 0, 0, 1} }, // '4'
-    { {1, 1, 1, 1, 0}, {0, 0, 0, 0, 1}, {0, 0, 0, 0, 1}, {1, 1, 1, 1, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 1, 1, 1, 1} }, // '5'
-    { {0, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 1, 0, 0, 1}, {1, 0, 1, 1, 0}, {1, 0, 0, 0, 0}, {0, 1, 1, 1, 1} }, // '6'
-    { {1, 0, 0, 0, 0}, {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 1, 0}, {0, 0, 0, 0, 1}, {0, 0, 0, 0, 1}, {1, 1, 1, 1, 1} }, // '7'
-    { {0, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {0, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {0, 1, 1, 1, 0} }, // '8'
-    { {1, 1, 1, 1, 0}, {0, 0, 0, 0, 1}, {0, 1, 1, 0, 1}, {1, 0, 0, 1, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {0, 1, 1, 1, 0} }, // '9'
-    { {0, 0, 0, 0, 0}, {0, 1, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 0, 0, 0}, {0, 1, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 0, 0, 0} }, // ':'
-    { {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 0, 0, 0}, {0, 1, 1, 0, 0}, {0, 1, 1, 0, 0}, {0, 0, 0, 0, 0} }, // ';'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '<'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '='
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '>'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '?'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '@'
-    { {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 1, 1, 1, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {0, 1, 1, 1, 0} }, // 'A'
-    { {1, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 1, 1, 1, 0} }, // 'B'
-    { {0, 1, 1, 1, 1}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {0, 1, 1, 1, 1} }, // 'C'
-    { {1, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 1, 1, 1, 0} }, // 'D'
-    { {1, 1, 1, 1, 1}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 1, 1, 1, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 1, 1, 1, 1} }, // 'E'
-    { {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 1, 1, 1, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 1, 1, 1, 1} }, // 'F'
-    { {0, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 1, 1, 1}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {0, 1, 1, 1, 1} }, // 'G'
-    { {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 1, 1, 1, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1} }, // 'H'
-    { {1, 1, 1, 1, 1}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {1, 1, 1, 1, 1} }, // 'I'
-    { {0, 1, 1, 0, 0}, {1, 0, 0, 1, 0}, {1, 0, 0, 1, 0}, {0, 0, 0, 1, 0}, {0, 0, 0, 1, 0}, {0, 0, 0, 1, 0}, {0, 0, 0, 1, 0} }, // 'J'
-    { {1, 0, 0, 0, 1}, {1, 0, 0, 1, 0}, {1, 0, 1, 0, 0}, {1, 1, 0, 0, 0}, {1, 0, 1, 0, 0}, {1, 0, 0, 1, 0}, {1, 0, 0, 0, 1} }, // 'K'
-    { {1, 1, 1, 1, 1}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0} }, // 'L'
-    { {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 1, 0, 1}, {1, 0, 1, 0, 1}, {1, 1, 0, 1, 1}, {1, 0, 0, 0, 1} }, // 'M'
-    { {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 1, 1}, {1, 0, 1, 0, 1}, {1, 1, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1} }, // 'N'
-    { {0, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {0, 1, 1, 1, 0} }, // 'O'
-    { {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {1, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 1, 1, 1, 0} }, // 'P'
-    { {0, 1, 1, 1, 1}, {1, 0, 0, 1, 1}, {1, 0, 1, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {0, 1, 1, 1, 0} }, // 'Q'
-    { {1, 0, 0, 0, 1}, {1, 0, 0, 1, 0}, {1, 0, 1, 0, 0}, {1, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 1, 1, 1, 0} }, // 'R'
-    { {1, 1, 1, 1, 0}, {0, 0, 0, 0, 1}, {0, 0, 0, 0, 1}, {0, 1, 1, 1, 0}, {1, 0, 0, 0, 0}, {1, 0, 0, 0, 0}, {0, 1, 1, 1, 1} }, // 'S'
-    { {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {1, 1, 1, 1, 1} }, // 'T'
-    { {0, 1, 1, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1} }, // 'U'
-    { {0, 0, 1, 0, 0}, {0, 1, 0, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1} }, // 'V'
-    { {1, 0, 0, 0, 1}, {1, 1, 0, 1, 1}, {1, 0, 1, 0, 1}, {1, 0, 1, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1} }, // 'W'
-    { {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1}, {0, 1, 0, 1, 0}, {0, 0, 1, 0, 0}, {0, 1, 0, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1} }, // 'X'
-    { {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 1, 0, 0}, {0, 1, 0, 1, 0}, {1, 0, 0, 0, 1}, {1, 0, 0, 0, 1} }, // 'Y'
-    { {1, 1, 1, 1, 1}, {1, 0, 0, 0, 0}, {0, 1, 0, 0, 0}, {0, 0, 1, 0, 0}, {0, 0, 0, 1, 0}, {0, 0, 0, 0, 1}, {1, 1, 1, 1, 1} }, // 'Z'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '['
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '\'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // ']'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '^'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '_'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '`'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'a'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'b'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'c'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'd'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'e'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'f'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'g'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'h'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'i'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'j'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'k'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'l'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'm'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'n'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'o'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'p'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'q'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'r'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 's'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 't'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'u'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'v'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'w'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'x'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'y'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // 'z'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '{'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '|'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '}'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // '~'
-    { {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0} }, // ''
+constexpr uint8_t ASCII_DIGIT_MAP[128][DIGIT_HEIGHT] = {
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'NUL'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'SOH'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'STX'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'ETX'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'EOT'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'ENQ'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'ACK'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'BEL'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'BS'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'TAB'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'LF'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'VT'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'FF'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'CR'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'SO'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'SI'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'DLE'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'DC1'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'DC2'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'DC3'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'DC4'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'NAK'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'SYN'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'ETB'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'CAN'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'EM'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'SUB'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'ESC'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'FS'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'GS'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'RS'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // 'US'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // ' '
+    { 0b01100, 0b01100, 0b00000, 0b01100, 0b01100, 0b01100, 0b01100 }, // '!'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '"'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '#'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '$'
+    { 0b10011, 0b10011, 0b01000, 0b00100, 0b00010, 0b11001, 0b11001 }, // '%'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '&'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '''
+    { 0b00010, 0b00100, 0b01000, 0b01000, 0b01000, 0b00100, 0b00010 }, // '('
+    { 0b01000, 0b00100, 0b00010, 0b00010, 0b00010, 0b00100, 0b01000 }, // ')'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '*'
+    { 0b00000, 0b00100, 0b00100, 0b11111, 0b00100, 0b00100, 0b00000 }, // '+'
+    { 0b01000, 0b00100, 0b01100, 0b00000, 0b00000, 0b00000, 0b00000 }, // ','
+    { 0b00000, 0b00000, 0b00000, 0b11111, 0b00000, 0b00000, 0b00000 }, // '-'
+    { 0b00000, 0b01100, 0b01100, 0b00000, 0b00000, 0b00000, 0b00000 }, // '.'
+    { 0b11000, 0b11000, 0b01100, 0b00100, 0b00110, 0b00011, 0b00011 }, // '/'
+    { 0b01110, 0b10001, 0b10001, 0b10101, 0b10001, 0b10001, 0b01110 }, // '0'
+    { 0b11111, 0b00100, 0b00100, 0b00100, 0b10100, 0b01100, 0b00100 }, // '1'
+    { 0b11111, 0b10000, 0b01000, 0b00110, 0b00001, 0b00001, 0b11110 }, // '2'
+    { 0b11110, 0b00001, 0b00001, 0b01110, 0b00001, 0b00001, 0b11110 }, // '3'
+    { 0b00001, 0b00001, 0b11111, 0b01001, 0b00101, 0b00011, 0b00001 }, // '4'
+    { 0b11110, 0b00001, 0b00001, 0b11110, 0b10000, 0b10000, 0b11111 }, // '5'
+    { 0b01110, 0b10001, 0b10001, 0b11001, 0b10110, 0b10000, 0b01111 }, // '6'
+    { 0b10000, 0b01000, 0b00100, 0b00010, 0b00001, 0b00001, 0b11111 }, // '7'
+    { 0b01110, 0b10001, 0b10001, 0b01110, 0b10001, 0b10001, 0b01110 }, // '8'
+    { 0b11110, 0b00001, 0b01101, 0b10011, 0b10001, 0b10001, 0b01110 }, // '9'
+    { 0b00000, 0b01100, 0b01100, 0b00000, 0b01100, 0b01100, 0b00000 }, // ':'
+    { 0b01000, 0b00100, 0b01100, 0b00000, 0b01100, 0b01100, 0b00000 }, // ';'
+    { 0b00010, 0b00100, 0b01000, 0b10000, 0b01000, 0b00100, 0b00010 }, // '<'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '='
+    { 0b01000, 0b00100, 0b00010, 0b00001, 0b00010, 0b00100, 0b01000 }, // '>'
+    { 0b00100, 0b00000, 0b00100, 0b00010, 0b00001, 0b10001, 0b01110 }, // '?'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '@'
+    { 0b10001, 0b10001, 0b10001, 0b11111, 0b10001, 0b10001, 0b01110 }, // 'A'
+    { 0b11110, 0b10001, 0b10001, 0b11110, 0b10001, 0b10001, 0b11110 }, // 'B'
+    { 0b01111, 0b10000, 0b10000, 0b10000, 0b10000, 0b10000, 0b01111 }, // 'C'
+    { 0b11110, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b11110 }, // 'D'
+    { 0b11111, 0b10000, 0b10000, 0b11110, 0b10000, 0b10000, 0b11111 }, // 'E'
+    { 0b10000, 0b10000, 0b10000, 0b11110, 0b10000, 0b10000, 0b11111 }, // 'F'
+    { 0b01110, 0b10001, 0b10001, 0b10111, 0b10000, 0b10000, 0b01111 }, // 'G'
+    { 0b10001, 0b10001, 0b10001, 0b11111, 0b10001, 0b10001, 0b10001 }, // 'H'
+    { 0b11111, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b11111 }, // 'I'
+    { 0b01100, 0b10010, 0b10010, 0b00010, 0b00010, 0b00010, 0b00010 }, // 'J'
+    { 0b10001, 0b10010, 0b10100, 0b11000, 0b10100, 0b10010, 0b10001 }, // 'K'
+    { 0b11111, 0b10000, 0b10000, 0b10000, 0b10000, 0b10000, 0b10000 }, // 'L'
+    { 0b10001, 0b10001, 0b10001, 0b10101, 0b10101, 0b11011, 0b10001 }, // 'M'
+    { 0b10001, 0b10001, 0b10011, 0b10101, 0b11001, 0b10001, 0b10001 }, // 'N'
+    { 0b01110, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b01110 }, // 'O'
+    { 0b10000, 0b10000, 0b10000, 0b11110, 0b10001, 0b10001, 0b11110 }, // 'P'
+    { 0b01111, 0b10011, 0b10101, 0b10001, 0b10001, 0b10001, 0b01110 }, // 'Q'
+    { 0b10001, 0b10010, 0b10100, 0b11110, 0b10001, 0b10001, 0b11110 }, // 'R'
+    { 0b11110, 0b00001, 0b00001, 0b01110, 0b10000, 0b10000, 0b01111 }, // 'S'
+    { 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b11111 }, // 'T'
+    { 0b01110, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001 }, // 'U'
+    { 0b00100, 0b01010, 0b10001, 0b10001, 0b10001, 0b10001, 0b10001 }, // 'V'
+    { 0b10001, 0b11011, 0b10101, 0b10101, 0b10001, 0b10001, 0b10001 }, // 'W'
+    { 0b10001, 0b10001, 0b01010, 0b00100, 0b01010, 0b10001, 0b10001 }, // 'X'
+    { 0b00100, 0b00100, 0b00100, 0b00100, 0b01010, 0b10001, 0b10001 }, // 'Y'
+    { 0b11111, 0b10000, 0b01000, 0b00100, 0b00010, 0b00001, 0b11111 }, // 'Z'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '['
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '\'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // ']'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '^'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '_'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '`'
+    { 0b01111, 0b10001, 0b01111, 0b00001, 0b01110, 0b00000, 0b00000 }, // 'a'
+    { 0b11110, 0b10001, 0b10001, 0b11001, 0b10110, 0b10000, 0b10000 }, // 'b'
+    { 0b01110, 0b10001, 0b10000, 0b10000, 0b01110, 0b00000, 0b00000 }, // 'c'
+    { 0b01111, 0b10001, 0b10001, 0b10011, 0b01101, 0b00001, 0b00001 }, // 'd'
+    { 0b01110, 0b10000, 0b11111, 0b10001, 0b01110, 0b00000, 0b00000 }, // 'e'
+    { 0b01000, 0b01000, 0b01000, 0b11100, 0b01000, 0b01001, 0b00110 }, // 'f'
+    { 0b01110, 0b00001, 0b01111, 0b10001, 0b10001, 0b01111, 0b00000 }, // 'g'
+    { 0b10001, 0b10001, 0b10001, 0b11001, 0b10110, 0b10000, 0b10000 }, // 'h'
+    { 0b01110, 0b00100, 0b00100, 0b00100, 0b01100, 0b00000, 0b00100 }, // 'i'
+    { 0b01100, 0b10010, 0b00010, 0b00010, 0b00110, 0b00000, 0b00010 }, // 'j'
+    { 0b10010, 0b10100, 0b11000, 0b10100, 0b10010, 0b10000, 0b10000 }, // 'k'
+    { 0b01110, 0b00100, 0b00100, 0b00100, 0b00100, 0b00100, 0b01100 }, // 'l'
+    { 0b10001, 0b10001, 0b10101, 0b10101, 0b11010, 0b00000, 0b00000 }, // 'm'
+    { 0b10001, 0b10001, 0b10001, 0b11001, 0b10110, 0b00000, 0b00000 }, // 'n'
+    { 0b01110, 0b10001, 0b10001, 0b10001, 0b01110, 0b00000, 0b00000 }, // 'o'
+    { 0b10000, 0b10000, 0b11110, 0b10001, 0b10001, 0b11110, 0b00000 }, // 'p'
+    { 0b00001, 0b00001, 0b01111, 0b10001, 0b10001, 0b01111, 0b00000 }, // 'q'
+    { 0b10000, 0b10000, 0b10000, 0b11001, 0b10110, 0b00000, 0b00000 }, // 'r'
+    { 0b11110, 0b00001, 0b01110, 0b10000, 0b01110, 0b00000, 0b00000 }, // 's'
+    { 0b00110, 0b01001, 0b01000, 0b01000, 0b11100, 0b01000, 0b01000 }, // 't'
+    { 0b01101, 0b10011, 0b10001, 0b10001, 0b10001, 0b00000, 0b00000 }, // 'u'
+    { 0b00100, 0b01010, 0b10001, 0b10001, 0b10001, 0b00000, 0b00000 }, // 'v'
+    { 0b01010, 0b10101, 0b10101, 0b10001, 0b10001, 0b00000, 0b00000 }, // 'w'
+    { 0b10001, 0b01010, 0b00100, 0b01010, 0b10001, 0b00000, 0b00000 }, // 'x'
+    { 0b01110, 0b00001, 0b01111, 0b10001, 0b10001, 0b10001, 0b00000 }, // 'y'
+    { 0b11111, 0b01000, 0b00100, 0b00010, 0b11111, 0b00000, 0b00000 }, // 'z'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '{'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '|'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '}'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // '~'
+    { 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b00000 }, // ''
 };
 
+constexpr glyph_t calcGlyph( const uint8_t (&pGlyphRows)[DIGIT_HEIGHT] ) {
+    glyph_t glyph = {};
+    for( uint32_t rowIdx = 0; rowIdx < DIGIT_HEIGHT; rowIdx++ ) {
+        for( uint32_t colIdx = 0; colIdx < DIGIT_WIDTH; ) {
+            const auto cIsLit = [&] ( const uint32_t pColIdx ) {
+                return ( (pGlyphRows[rowIdx] >> (DIGIT_WIDTH - 1 - pColIdx)) & 1 ) != 0;
+            };
+            if( !cIsLit(colIdx) ) {
+                colIdx++;
+                continue;
+            }
+
+            const uint32_t cRunStart = colIdx;
+            for( ; colIdx < DIGIT_WIDTH && cIsLit(colIdx); colIdx++ ) {}
+            const uint32_t cRunLength = colIdx - cRunStart;
+
+            // NOTE(JRC): A run extends the rectangle directly below it if that
+            // rectangle spans the exact same columns, and starts a new one otherwise.
+            // Glyphs that need more than 'glyph_t::MAX_RECTS' rectangles fail to
+            // compile here since the write is out of bounds in a constant expression.
+            bool32_t isMerged = false;
+            for( uint32_t rectIdx = 0; rectIdx < glyph.mRectCount && !isMerged; rectIdx++ ) {
+                uint8_t (&rect)[4] = glyph.mRects[rectIdx];
+                if( rect[0] == cRunStart && rect[2] == cRunLength && rect[1] + rect[3] == rowIdx ) {
+                    rect[3]++;
+                    isMerged = true;
+                }
+            }
+            if( !isMerged ) {
+                uint8_t (&rect)[4] = glyph.mRects[glyph.mRectCount++];
+                rect[0] = cRunStart; rect[1] = rowIdx;
+                rect[2] = cRunLength; rect[3] = 1;
+            }
+        }
+    }
+    return glyph;
+}
+
+
+constexpr std::array<glyph_t, 128> calcGlyphMap() {
+    std::array<glyph_t, 128> glyphMap = {};
+    for( uint32_t glyphIdx = 0; glyphIdx < 128; glyphIdx++ ) {
+        glyphMap[glyphIdx] = calcGlyph( ASCII_DIGIT_MAP[glyphIdx] );
+    }
+    return glyphMap;
+}
+
+
+constexpr std::array<glyph_t, 128> ASCII_GLYPH_MAP = calcGlyphMap();
+
 };
 
 };
@@ -4,8 +4,11 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
 
+#include <array>
+
 #include "box_t.h"
 #include "circle_t.h"
+#include "raster_t.h"
 #include "consts.h"
 
 namespace llce {
@@ -16,7 +19,57 @@ namespace gfx {
 
 constexpr static uint32_t DIGIT_WIDTH = 5, DIGIT_HEIGHT = 7;
 constexpr static float64_t DIGIT_ASPECT = ( DIGIT_WIDTH + 0.0 ) / ( DIGIT_HEIGHT + 0.0 );
-const extern bool8_t ASCII_DIGIT_MAP[128][DIGIT_HEIGHT][DIGIT_WIDTH];
+
+// NOTE(JRC): Frame buffer contents can be tagged with a key that summarizes all of
+// the inputs used to render them (see 'fbo_context_t'), which allows renderers to
+// skip re-rendering layers whose inputs haven't changed (see 'stale'). Contents
+// rendered without a key are tagged as unkeyed, which are always considered stale,
+// as are contents rendered at a different resolution than the one requested.
+constexpr static uint64_t CONTENT_UNKEYED = ~0ULL;
+
+// NOTE(JRC): Each glyph row is packed into the low bits of a byte with the leftmost
+// pixel in the highest bit (so that binary literals read left-to-right), and the
+// rows are ordered from the bottom of the glyph to the top.
+const extern uint8_t ASCII_DIGIT_MAP[128][DIGIT_HEIGHT];
+
+// NOTE(JRC): The glyph map is a minimal cover of the lit pixels of each glyph in
+// 'ASCII_DIGIT_MAP', which is generated at compile time by merging the horizontal
+// runs of each row and then merging the identical runs of adjacent rows. Each
+// rectangle is given in glyph pixels as (x, y, width, height) from the bottom left.
+struct glyph_t {
+    constexpr static uint32_t MAX_RECTS = 9;
+
+    uint8_t mRectCount;
+    uint8_t mRects[MAX_RECTS][4];
+};
+
+const extern std::array<glyph_t, 128> ASCII_GLYPH_MAP;
+
+// NOTE(JRC): The software backend rasterizes all primitives on the CPU into
+// 'raster_t' targets instead of submitting them to OpenGL, which allows frames to
+// be rendered without a graphics device (e.g. in headless runs). Its frame buffers
+// are identified in the same way as OpenGL frame buffers (see 'fbo_t'), so code
+// written against the 'llce::gfx' interface works unmodified with either backend.
+// Software drawing is deferred until 'finish' is called (or a target is read
+// via 'raster'), at which point all pending targets are rasterized in parallel.
+LLCE_ENUM( backend, gl, soft );
+
+// NOTE(JRC): While a command list is being recorded (see 'record'), all drawing
+// and state changes are encoded into the list instead of being submitted, which
+// allows the simulation's drawing to be measured, stored, and replayed later (see
+// 'execute') by the harness. Polygons are recorded after the context transform is
+// applied, so each is stored as a single color plus its vertices (and texture
+// coordinates, if any). Each list can also be summarized by a content key (see
+// 'list_t::key'), which lets the harness detect frames whose drawing is unchanged.
+LLCE_ENUM( command, polygon, clear, resolve, blit, framebuffer, viewport, scissor, projection, modelview, color, timestamp );
+
+// NOTE(JRC): GPU render times are measured per pass, where each pass covers all of
+// the OpenGL work submitted within its timer contexts (see 'timer_context_t') over
+// the course of a frame. Frame buffer contexts and blits are timed automatically as
+// the 'layer' and 'composite' passes, respectively. Times are only measured while
+// profiling is enabled (see 'profile') and are reported a few frames after they're
+// submitted (see 'timings') so that reading them never stalls the GPU.
+LLCE_ENUM( pass, layer, composite, present, overlay, capture );
 
 /// Namespace Types ///
 
@@ -38,33 +91,132 @@ struct render_context_t {
 };
 
 
+// NOTE(JRC): Primitives are batched and submitted in bulk (see 'flush'), so
+// any code that issues raw OpenGL calls within the scope of the other contexts
+// must do so within a raw context, which submits the pending batch and loads
+// the current context transform/color into the OpenGL state.
+struct raw_context_t {
+    raw_context_t();
+    ~raw_context_t();
+
+    mat4f32_t mModelview;
+    color4u8_t mColor;
+};
+
+
+// NOTE(JRC): Frame buffers default to 8-bit RGBA color without depth since all
+// rendering is 2D and the harness never tests depth. Multisampled frame
+// buffers are resolved into their color textures at the end of each frame buffer
+// context, and the scale is applied to the frame buffer's resolution by the
+// owner of the frame buffer (see 'llce::output::boot').
+LLCE_ENUM( pixel, rgba8, rgb565 );
+
+struct format_t {
+    pixel_e mPixel = pixel::rgba8;
+    bool32_t mHasDepth = false;
+    uint32_t mSamples = 1;
+    float32_t mScale = 1.0f;
+};
+
+
 struct fbo_t {
-    fbo_t( const vec2u32_t pFBRes );
+    fbo_t( const vec2u32_t pFBRes, const format_t& pFormat = format_t() );
     ~fbo_t();
 
     bool32_t valid() const;
 
-    uint32_t mFrameID, mColorID, mDepthID;
+    uint32_t mFrameID, mColorID, mDepthID, mResolveID;
+};
+
+
+struct timer_context_t {
+    timer_context_t( const pass_e pPass );
+    ~timer_context_t();
+
+    pass_e mPass;
 };
 
 
 struct fbo_context_t {
-    fbo_context_t( const uint32_t pFBID, const vec2u32_t pFBRes );
+    fbo_context_t( const uint32_t pFBID, const vec2u32_t pFBRes, const uint64_t pContentKey = CONTENT_UNKEYED );
     ~fbo_context_t();
 
+    uint32_t mFrameID;
     vec2i32_t mViewport[2], mScissor[2];
 };
 
+
+// NOTE(JRC): The 'llce::gfx' module keeps a CPU-side shadow of all of the OpenGL
+// state that it reads or writes so that queries never require a round trip to the
+// driver and redundant state changes are filtered out before they reach OpenGL.
+// Consequently, all code that changes these states must do so through the
+// 'llce::gfx::state' functions (or call 'state::invalidate' after doing otherwise).
+struct state_t {
+    vec2i32_t mViewport[2], mScissor[2];
+    mat4f32_t mProjection, mModelview;
+    uint32_t mFrameID;
+    color4u8_t mColor;
+    vec2i32_t mWindowDims;
+
+    uint32_t mStaleMask;
+};
+
+
+struct list_t {
+    list_t( bit8_t* pBuffer, const uint64_t pBufferLength );
+
+    void reset();
+    uint64_t key() const;
+
+    bit8_t* mBuffer;
+    uint64_t mBufferLength;
+    uint64_t mLength, mPeakLength;
+    uint32_t mCounts[command::_length];
+    uint32_t mSpillCount;
+};
+
 /// Namespace Functions ///
 
 float32_t aspect( const vec2i32_t& pDims );
 float32_t aspect( const vec2u32_t& pDims );
 float32_t aspect( const vec2f32_t& pDims );
 
+void boot();
+void flush();
+void finish();
+
+void record( list_t* pList );
+void execute( const list_t& pList );
+
+void profile( const bool32_t pIsProfiling );
+bool32_t timings( float64_t (&pPassSecs)[pass::_length] );
+
+void select( const backend_e pBackend );
+backend_e active();
+const raster_t* raster( const uint32_t pFBID );
+
+void blit( const uint32_t pSrcFBID, const vec2u32_t& pSrcRes,
+    const box_t& pDstBox = box_t(0.0f, 0.0f, 1.0f, 1.0f) );
+bool32_t stale( const uint32_t pFBID, const vec2u32_t& pFBRes, const uint64_t pContentKey );
+
 mat4f32_t glMatrix();
 float32_t glAspect();
 
 
+namespace state {
+    const state_t& get();
+    void invalidate();
+
+    void viewport( const vec2i32_t& pPos, const vec2i32_t& pDims );
+    void scissor( const vec2i32_t& pPos, const vec2i32_t& pDims );
+    void projection( const mat4f32_t& pMatrix );
+    void modelview( const mat4f32_t& pMatrix );
+    void framebuffer( const uint32_t pFBID );
+    void color( const color4u8_t& pColor );
+    void window( const vec2i32_t& pDims );
+};
+
+
 namespace color {
     color4f32_t u82f32( const color4u8_t& pColor );
     color4u8_t f322u8( const color4f32_t& pColor );
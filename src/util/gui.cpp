@@ -175,10 +175,10 @@ void bind_menu_t::update( const float64_t pDT ) {
             if( !mListening ) {
                 mListening = true;
             } else if( !mCurrBindings.empty() ) {
-                auto bindingBuffer = mCurrBindings.compact();
-                bindingBuffer[mCurrBindings.size()] = llce::input::INPUT_UNBOUND_ID;
+                uint32_t bindingBuffer[LLCE_MAX_BINDINGS + 1];
+                *mCurrBindings.compact( &bindingBuffer[0] ) = llce::input::INPUT_UNBOUND_ID;
 
-                bool32_t bindingSuccess = mInput->mBinding.bind( mItemIndex + 1, bindingBuffer.data() );
+                bool32_t bindingSuccess = mInput->mBinding->bind( mItemIndex + 1, &bindingBuffer[0] );
                 mCurrBindings.clear();
                 mBinding = mListening = !bindingSuccess;
             }
@@ -260,7 +260,7 @@ void bind_menu_t::render() const {
                     if( !(mListening && itemIdx == mItemIndex) ) {
                         char8_t bindingNames[LLCE_MAX_BINDINGS][16];
                         uint32_t bindingIdx = 0, bindingCount = 0, bindingLength = 0;
-                        const uint32_t* cItemBinding = mInput->mBinding.find( itemIdx + 1 );
+                        const uint32_t* cItemBinding = mInput->mBinding->find( itemIdx + 1 );
                         for( bindingIdx = 0;
                                 cItemBinding[bindingIdx] != llce::input::INPUT_UNBOUND_ID;
                                 bindingIdx++, bindingCount++ ) {
@@ -1,15 +1,68 @@
 #include <SDL2/SDL.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <cstdio>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "input.h"
 
 namespace llce {
 
 namespace input {
 
+/// Helper Functions ///
+
+// NOTE(JRC): SDL reports the keyboard as an array of byte flags (0 or 1), which
+// are packed 16 at a time via byte comparisons and sign mask extraction when SSE2
+// is available. See here for details: https://www.felixcloutier.com/x86/pmovmskb
+inline void packButtons( const uint8_t* pStates, const uint32_t pStateCount, uint64_t* pBits ) {
+    uint32_t stateIdx = 0;
+#if defined(__SSE2__)
+    const __m128i cZeroes = _mm_setzero_si128();
+    for( ; stateIdx + 64 <= pStateCount; stateIdx += 64 ) {
+        uint64_t stateBits = 0;
+        for( uint32_t laneIdx = 0; laneIdx < 4; laneIdx++ ) {
+            const __m128i cStates = _mm_loadu_si128( (const __m128i*)&pStates[stateIdx + 16 * laneIdx] );
+            const uint32_t cZeroMask = _mm_movemask_epi8( _mm_cmpeq_epi8(cStates, cZeroes) );
+            stateBits |= static_cast<uint64_t>( ~cZeroMask & 0xFFFF ) << ( 16 * laneIdx );
+        }
+        pBits[stateIdx >> 6] = stateBits;
+    }
+#endif
+    for( ; stateIdx < pStateCount; stateIdx += 64 ) {
+        uint64_t stateBits = 0;
+        for( uint32_t bitIdx = 0; bitIdx < 64 && stateIdx + bitIdx < pStateCount; bitIdx++ ) {
+            stateBits |= static_cast<uint64_t>( pStates[stateIdx + bitIdx] != 0 ) << bitIdx;
+        }
+        pBits[stateIdx >> 6] = stateBits;
+    }
+}
+
+// NOTE(JRC): Global input identifiers are decoded with a table generated at
+// compile time, which maps each identifier to its device and local identifier.
+struct gidtable_t {
+    uint8_t mDevIDs[SDL_NUM_INPUTS];
+    uint16_t mIDs[SDL_NUM_INPUTS];
+};
+
+constexpr gidtable_t genGIDTable() {
+    gidtable_t table = {};
+    for( uint32_t deviceID = 0, globalID = 0; deviceID < device::_length; deviceID++ ) {
+        for( uint32_t inputID = 0; inputID < SDL_NUM_DEVICE_INPUTS[deviceID]; inputID++, globalID++ ) {
+            table.mDevIDs[globalID] = static_cast<uint8_t>( deviceID );
+            table.mIDs[globalID] = static_cast<uint16_t>( inputID );
+        }
+    }
+    return table;
+}
+
+constexpr static gidtable_t csGIDTable = genGIDTable();
+
 /// 'llce::input::stream_t' Functions ///
 
 stream_t::stream_t() :
@@ -30,15 +83,16 @@ stream_t::stream_t( uint32_t pDevID, uint32_t pID ) :
 }
 
 
-stream_t::stream_t( uint32_t pGlobalID ) {
-    uint32_t deviceID = 0, deviceOffset = SDL_NUM_DEVICE_INPUTS[0];
-    while( deviceOffset < pGlobalID ) {
-        deviceOffset += SDL_NUM_DEVICE_INPUTS[++deviceID];
-    }
-    uint32_t inputID = pGlobalID - ( deviceOffset - SDL_NUM_DEVICE_INPUTS[deviceID] );
+stream_t::stream_t( uint32_t pGlobalID ) :
+        mDevID( device_e::unbound ), mID( 0 ) {
+    LLCE_CHECK_ERROR( pGlobalID < SDL_NUM_INPUTS,
+        "Unable to decode global input identifier " << pGlobalID << "; " <<
+        "identifiers must be less than " << SDL_NUM_INPUTS << "." );
 
-    mDevID = static_cast<device_e>( deviceID );
-    mID = inputID;
+    if( pGlobalID < SDL_NUM_INPUTS ) {
+        mDevID = static_cast<device_e>( csGIDTable.mDevIDs[pGlobalID] );
+        mID = csGIDTable.mIDs[pGlobalID];
+    }
 }
 
 
@@ -64,7 +118,9 @@ stream_t::operator uint32_t() const {
         deviceOffset += SDL_NUM_DEVICE_INPUTS[deviceID];
     }
 
-    return deviceOffset + mID;
+    // NOTE(JRC): Inputs on disabled devices (see 'LLCE_INPUT_*') have no global
+    // identifiers, so they're all mapped to the unbound identifier.
+    return ( mID < SDL_NUM_DEVICE_INPUTS[(uint32_t)mDevID] ) ? deviceOffset + mID : INPUT_UNBOUND_ID;
 }
 
 
@@ -79,6 +135,7 @@ stream_t::operator uint64_t() const {
 binding_t::binding_t() {
     std::memset( &mActionBindings[0], INPUT_UNBOUND_ID, sizeof(mActionBindings) );
     std::memset( &mBoundActions[0], ACTION_UNBOUND_ID, sizeof(mBoundActions) );
+    mVersion = 0;
 }
 
 
@@ -128,6 +185,8 @@ bool32_t binding_t::bind( const uint32_t pActionID, const uint32_t* pInputGIDs )
             mActionBindings[pActionID][bindingIdx] = pInputGIDs[bindingIdx];
             mBoundActions[pInputGIDs[bindingIdx]] = pActionID;
         }
+
+        mVersion++;
     }
 
     return validBind;
@@ -145,25 +204,22 @@ const uint32_t* binding_t::find( const uint32_t pActionID ) const {
 
 /// 'llce::input::input_t' Functions ///
 
-bool32_t input_t::read( const device_e pDevID ) {
+bool32_t input_t::read( const device_e pDevID, const edge_t* pEdges, const uint32_t pEdgeCount ) {
     bool32_t success = true;
 
+#if LLCE_INPUT_KEYBOARD
     if( pDevID == device_e::unbound || pDevID == device_e::keyboard ) {
         const uint8_t* keyboardState = SDL_GetKeyboardState( nullptr );
 
-        for( uint32_t keyIdx = 0; keyIdx < keyboard_t::NUM_BUTTONS; keyIdx++ ) {
-            const bool8_t wasKeyDown = mKeyboard.buttons[keyIdx];
-            const bool8_t isKeyDown = keyboardState[keyIdx];
-
-            mKeyboard.buttons[keyIdx] = isKeyDown;
-            mKeyboard.dbuttons[keyIdx] = (
-                (!wasKeyDown && isKeyDown) ? diff_e::down : (
-                (wasKeyDown && !isKeyDown) ? diff_e::up : (
-                diff_e::none)) );
-        }
+        keyboard_t::buttonstates_t keyboardButtons;
+        packButtons( keyboardState, keyboard_t::NUM_BUTTONS, &keyboardButtons[0] );
+        mKeyboard.update( &keyboardButtons[0] );
 
         success &= true;
-    } if( pDevID == device_e::unbound || pDevID == device_e::mouse ) {
+    }
+#endif
+#if LLCE_INPUT_MOUSE
+    if( pDevID == device_e::unbound || pDevID == device_e::mouse ) {
         // NOTE(JRC): The global mouse state will report the state of the mouse
         // regardless of where it's located on the screen where the window mouse
         // state will only report buttons pressed while the mouse is in focus.
@@ -172,17 +228,10 @@ bool32_t input_t::read( const device_e pDevID ) {
         const uint32_t cWindowButtonMask = SDL_GetMouseState( &isticks[0].x, &isticks[0].y );
         SDL_GetGlobalMouseState( &isticks[1].x, &isticks[1].y );
 
-        // NOTE(JRC): The mouse button identifiers start at 1 instead of 0 for SDL.
-        for( uint32_t buttonIdx = 1; buttonIdx < mouse_t::NUM_BUTTONS; buttonIdx++ ) {
-            const bool8_t wasButtonDown = mMouse.buttons[buttonIdx];
-            const bool8_t isButtonDown = cWindowButtonMask & SDL_BUTTON( buttonIdx );
-
-            mMouse.buttons[buttonIdx] = isButtonDown;
-            mMouse.dbuttons[buttonIdx] = (
-                (!wasButtonDown && isButtonDown) ? diff_e::down : (
-                (wasButtonDown && !isButtonDown) ? diff_e::up : (
-                diff_e::none)) );
-        }
+        // NOTE(JRC): The mouse button identifiers start at 1 instead of 0 for SDL,
+        // so the button mask is shifted to place each button at its identifier's bit.
+        mouse_t::buttonstates_t mouseButtons = { static_cast<uint64_t>(cWindowButtonMask) << 1 };
+        mMouse.update( &mouseButtons[0] );
 
         for( uint32_t stickIdx = 0; stickIdx < mouse_t::NUM_STICKS; stickIdx++ ) {
             mMouse.dsticks[stickIdx].x = isticks[stickIdx].x - mMouse.sticks[stickIdx].x;
@@ -196,36 +245,58 @@ bool32_t input_t::read( const device_e pDevID ) {
         // mMouse.focus = SDL_GetMouseFocus();
         success &= true;
     }
+#endif
+
+    // NOTE(JRC): Device states are only sampled at frame boundaries, so any button
+    // that was pressed and released between reads (or vice versa) would otherwise
+    // be lost. Folding in the transition edges ensures that such taps still register
+    // as pressed/released in this frame, even though the button's down state is unchanged.
+    mEdgeCount = std::min( pEdgeCount, MAX_EDGES );
+    for( uint32_t edgeIdx = 0; edgeIdx < mEdgeCount; edgeIdx++ ) {
+        const edge_t& cEdge = mEdges[edgeIdx] = pEdges[edgeIdx];
+        const device_e cDevID = static_cast<device_e>( csGIDTable.mDevIDs[cEdge.mGID] );
+        const uint32_t cID = csGIDTable.mIDs[cEdge.mGID];
+
+        uint64_t* edgeState = ( pDevID == device_e::unbound || pDevID == cDevID ) ?
+            state( cDevID, cEdge.mDiff ) : nullptr;
+        if( edgeState != nullptr && cEdge.mDiff != diff_e::none ) {
+            edgeState[cID >> 6] |= 1ull << ( cID & 63 );
+        }
+    }
 
-    return success;
-}
-
-
-uint8_t* input_t::state( const device_e pDevID ) {
-    return (
-        (pDevID == device_e::keyboard) ? &mKeyboard.buttons[0] : (
-        (pDevID == device_e::mouse) ? &mMouse.buttons[0] : nullptr ));
-}
-
+    std::memset( &mActions[0], 0, sizeof(mActions) );
+    for( uint32_t actionIdx = 1; mBinding != nullptr && actionIdx < LLCE_MAX_ACTIONS; actionIdx++ ) {
+        const uint32_t* cActionGIDs = mBinding->find( actionIdx );
+        for( uint32_t bindingIdx = 0; binding_t::valid(cActionGIDs, bindingIdx); bindingIdx++ ) {
+            const device_e cDevID = static_cast<device_e>( csGIDTable.mDevIDs[cActionGIDs[bindingIdx]] );
+            const uint32_t cID = csGIDTable.mIDs[cActionGIDs[bindingIdx]];
+            for( uint32_t diffIdx = 0; diffIdx < 3; diffIdx++ ) {
+                const uint64_t* cInputState = state( cDevID, static_cast<diff_e>(diffIdx) );
+                if( cInputState != nullptr && test(cInputState, cID) ) {
+                    mActions[diffIdx][actionIdx >> 6] |= 1ull << ( actionIdx & 63 );
+                }
+            }
+        }
+    }
 
-const uint8_t* input_t::state( const device_e pDevID ) const {
-    return (
-        (pDevID == device_e::keyboard) ? &mKeyboard.buttons[0] : (
-        (pDevID == device_e::mouse) ? &mMouse.buttons[0] : nullptr ));
+    return success;
 }
 
 
-diff_e* input_t::diffs( const device_e pDevID ) {
-    return (
-        (pDevID == device_e::keyboard) ? &mKeyboard.dbuttons[0] : (
-        (pDevID == device_e::mouse) ? &mMouse.dbuttons[0] : nullptr ));
+uint64_t* input_t::state( const device_e pDevID, const diff_e pDiff ) {
+    return const_cast<uint64_t*>( static_cast<const input_t*>(this)->state(pDevID, pDiff) );
 }
 
 
-const diff_e* input_t::diffs( const device_e pDevID ) const {
+const uint64_t* input_t::state( const device_e pDevID, const diff_e pDiff ) const {
     return (
-        (pDevID == device_e::keyboard) ? &mKeyboard.dbuttons[0] : (
-        (pDevID == device_e::mouse) ? &mMouse.dbuttons[0] : nullptr ));
+        (pDevID == device_e::keyboard && keyboard_t::NUM_BUTTONS > 0) ? (
+            (pDiff == diff_e::down) ? &mKeyboard.pbuttons[0] : (
+            (pDiff == diff_e::up) ? &mKeyboard.rbuttons[0] : &mKeyboard.buttons[0] )) : (
+        (pDevID == device_e::mouse && mouse_t::NUM_BUTTONS > 0) ? (
+            (pDiff == diff_e::down) ? &mMouse.pbuttons[0] : (
+            (pDiff == diff_e::up) ? &mMouse.rbuttons[0] : &mMouse.buttons[0] )) :
+        nullptr ));
 }
 
 
@@ -247,19 +318,19 @@ uint32_t input_t::isDiffRaw( diff_f pDiff, const uint32_t* pInputGIDs ) const {
 }
 
 
-uint32_t input_t::isDiffAct( diff_f pDiff, const uint32_t pInputAction ) const {
-    return isDiffRaw( pDiff, mBinding.find(pInputAction) );
+uint32_t input_t::isDiffAct( const diff_e pDiff, const uint32_t pInputAction ) const {
+    const uint64_t* cActionState = &mActions[static_cast<uint32_t>(pDiff)][0];
+    return test( cActionState, pInputAction ) ? pInputAction : ACTION_UNBOUND_ID;
 }
 
 
-uint32_t input_t::isDiffAct( diff_f pDiff, const uint32_t* pInputActions ) const {
+uint32_t input_t::isDiffAct( const diff_e pDiff, const uint32_t* pInputActions ) const {
     uint32_t firstAction = ACTION_UNBOUND_ID;
     for( uint32_t actionIdx = 0;
             pInputActions[actionIdx] != ACTION_UNBOUND_ID &&
             firstAction == ACTION_UNBOUND_ID;
             actionIdx++ ) {
-        firstAction = isDiffRaw( pDiff, mBinding.find(pInputActions[actionIdx]) ) ?
-            pInputActions[actionIdx] : ACTION_UNBOUND_ID;
+        firstAction = isDiffAct( pDiff, pInputActions[actionIdx] );
     }
     return firstAction;
 }
@@ -268,22 +339,22 @@ uint32_t input_t::isDiffAct( diff_f pDiff, const uint32_t* pInputActions ) const
 
 bool32_t isDown( const input_t* pInput, const uint32_t pInputGID ) {
     const stream_t cInputStream( pInputGID );
-    const uint8_t* cInputState = pInput->state( cInputStream.mDevID );
-    return (bool32_t)( cInputState != nullptr && cInputState[cInputStream.mID] );
+    const uint64_t* cInputState = pInput->state( cInputStream.mDevID, diff_e::none );
+    return (bool32_t)( cInputState != nullptr && test(cInputState, cInputStream.mID) );
 }
 
 
 bool32_t isPressed( const input_t* pInput, const uint32_t pInputGID ) {
     const stream_t cInputStream( pInputGID );
-    const diff_e* cInputDiffs = pInput->diffs( cInputStream.mDevID );
-    return (bool32_t)( cInputDiffs != nullptr && (cInputDiffs[cInputStream.mID] == diff_e::down) );
+    const uint64_t* cInputState = pInput->state( cInputStream.mDevID, diff_e::down );
+    return (bool32_t)( cInputState != nullptr && test(cInputState, cInputStream.mID) );
 }
 
 
 bool32_t isReleased( const input_t* pInput, const uint32_t pInputGID ) {
     const stream_t cInputStream( pInputGID );
-    const diff_e* cInputDiffs = pInput->diffs( cInputStream.mDevID );
-    return (bool32_t)( cInputDiffs != nullptr && (cInputDiffs[cInputStream.mID] == diff_e::up) );
+    const uint64_t* cInputState = pInput->state( cInputStream.mDevID, diff_e::up );
+    return (bool32_t)( cInputState != nullptr && test(cInputState, cInputStream.mID) );
 }
 
 
@@ -3,6 +3,8 @@
 
 #include <SDL2/SDL.h>
 
+#include <cstddef>
+
 #include "consts.h"
 
 namespace llce {
@@ -33,10 +35,22 @@ struct device_t {
     const static uint32_t NUM_INPUTS = Buttons + Levers + Sticks;
 
     // Buttons (0D) //
-    typedef uint8_t buttonstates_t[Buttons];
-    typedef diff_e buttondiffs_t[Buttons];
-    buttonstates_t buttons = {};
-    buttondiffs_t dbuttons = {};
+    // NOTE(JRC): Button states are packed into 64-bit words (one bit per button)
+    // so that transitions can be computed for many buttons at once (see 'update').
+    const static uint32_t NUM_BUTTON_WORDS = ( Buttons + 63 ) / 64;
+    typedef uint64_t buttonstates_t[NUM_BUTTON_WORDS];
+    buttonstates_t buttons = {};  // down
+    buttonstates_t pbuttons = {}; // pressed (up => down)
+    buttonstates_t rbuttons = {}; // released (down => up)
+
+    inline void update( const uint64_t* pButtons ) {
+        for( uint32_t wordIdx = 0; wordIdx < NUM_BUTTON_WORDS; wordIdx++ ) {
+            const uint64_t cButtonDiffs = buttons[wordIdx] ^ pButtons[wordIdx];
+            pbuttons[wordIdx] = cButtonDiffs & pButtons[wordIdx];
+            rbuttons[wordIdx] = cButtonDiffs & buttons[wordIdx];
+            buttons[wordIdx] = pButtons[wordIdx];
+        }
+    }
 
     // Levers (1D) //
     typedef float32_t leverstates_t[Levers];
@@ -53,8 +67,19 @@ struct device_t {
 
 
 typedef device_t<1, 0, 0> dummy_t;
+// NOTE(JRC): Devices that are disabled in the configuration (see 'LLCE_INPUT_*')
+// are reduced to empty placeholders, which have no inputs (and thus no global
+// identifiers) and occupy no space in 'input_t'.
+#if LLCE_INPUT_KEYBOARD
 typedef device_t<SDL_Scancode::SDL_NUM_SCANCODES, 0, 0> keyboard_t;
+#else
+typedef device_t<0, 0, 0> keyboard_t;
+#endif
+#if LLCE_INPUT_MOUSE
 typedef device_t<SDL_BUTTON_X2 + 1, 0, 2> mouse_t;
+#else
+typedef device_t<0, 0, 0> mouse_t;
+#endif
 static constexpr uint32_t SDL_NUM_DEVICE_INPUTS[] = { dummy_t::NUM_INPUTS, keyboard_t::NUM_INPUTS, mouse_t::NUM_INPUTS };
 static constexpr uint32_t SDL_NUM_INPUTS = dummy_t::NUM_INPUTS + keyboard_t::NUM_INPUTS + mouse_t::NUM_INPUTS;
 
@@ -77,6 +102,15 @@ struct stream_t {
 };
 
 
+// NOTE(JRC): An edge is a single button transition along with the time elapsed
+// (in seconds) between the transition and the frame read it was folded into.
+struct edge_t {
+    uint32_t mGID;
+    diff_e mDiff;
+    float32_t mAge;
+};
+
+
 struct binding_t {
     binding_t();
     binding_t( const uint32_t* pInputGIDs );
@@ -95,6 +129,8 @@ struct binding_t {
     uint32_t mActionBindings[LLCE_MAX_ACTIONS][LLCE_MAX_BINDINGS + 1];
     // sim-agnostic global id => sim-specific action id
     uint32_t mBoundActions[SDL_NUM_INPUTS];
+    // incremented on every successful rebinding (used to detect changes)
+    uint32_t mVersion;
 };
 
 /// Namespace Functions ///
@@ -106,55 +142,74 @@ bool32_t isDown( const input_t* pInput, const uint32_t pInputGID );
 bool32_t isPressed( const input_t* pInput, const uint32_t pInputGID );
 bool32_t isReleased( const input_t* pInput, const uint32_t pInputGID );
 
+// NOTE(JRC): This function is used to query individual bits from the
+// packed button states stored in each 'device_t' instance.
+inline bool32_t test( const uint64_t* pBits, const uint32_t pIndex ) {
+    return (bool32_t)( (pBits[pIndex >> 6] >> (pIndex & 63)) & 0b1 );
+}
+
 const char8_t* identify( const uint32_t pInputGID );
 bool32_t identify( const uint32_t pInputGID, char8_t* pBuffer, const uint32_t pBufferLength );
 
 /// Namespace Potpourri ///
 
-// TODO(JRC): If so desired, the nice feature of only allocating memory to
-// relevant/supported input streams can be implemented by having pre-processor
-// CMake variables associated with the application (e.g. LLCE_HAS_KEYBOARD)
-// and then applying these preprocessor directives as appropriate.
-// TODO(JRC): Given that 'input_t' is going to become more accessible, the
-// next logical step is to wonder how to integrate 'binding_t' for tighter
-// data coupling. Is there any good way (e.g. via #defines) to provide a pointer
-// to the start of the 'input_t', and then the size, depending on user configuration?
+// NOTE(JRC): The 'input_t' type is split into per-frame device state, which
+// is the only data that needs to be copied by the harness into recordings,
+// backups and replays (see 'FRAME_BYTES'), and a reference to the (rarely
+// changing) bindings, which are owned by the harness and versioned separately.
 struct input_t {
+    // Frame Data //
     keyboard_t mKeyboard;
     mouse_t mMouse;
-    binding_t mBinding;
 
-    // declare size as static so that it can be used by the harness when doing 'memcpy' operations
+    // NOTE(JRC): The states of all bound actions are resolved once per frame
+    // by 'read' and stored as bitsets indexed by 'diff_e' (i.e. down, pressed,
+    // released), which reduces each action query to a single bit test.
+    const static uint32_t NUM_ACTION_WORDS = ( LLCE_MAX_ACTIONS + 63 ) / 64;
+    typedef uint64_t actionstates_t[NUM_ACTION_WORDS];
+    actionstates_t mActions[3] = {};
 
-    bool32_t read( const device_e pDevID = llce::input::device::unbound );
+    // NOTE(JRC): The transitions observed since the previous frame (in order),
+    // which are recorded alongside the device states so that replays reproduce
+    // sub-frame inputs (see 'read').
+    const static uint32_t MAX_EDGES = 32;
+    edge_t mEdges[MAX_EDGES] = {};
+    uint32_t mEdgeCount = 0;
 
-    uint8_t* state( const device_e pDevID );
-    const uint8_t* state( const device_e pDevID ) const;
+    // Configuration Data //
+    binding_t* mBinding = nullptr;
 
-    diff_e* diffs( const device_e pDevID );
-    const diff_e* diffs( const device_e pDevID ) const;
+    const static uint64_t FRAME_BYTES;
+
+    bool32_t read( const device_e pDevID = llce::input::device::unbound,
+        const edge_t* pEdges = nullptr, const uint32_t pEdgeCount = 0 );
+
+    uint64_t* state( const device_e pDevID, const diff_e pDiff = diff_e::none );
+    const uint64_t* state( const device_e pDevID, const diff_e pDiff = diff_e::none ) const;
 
     bool32_t isDiffRaw( diff_f pDiff, const uint32_t pInputGID ) const;
     uint32_t isDiffRaw( diff_f pDiff, const uint32_t* pInputGIDs ) const;
-    uint32_t isDiffAct( diff_f pDiff, const uint32_t pInputAction ) const;
-    uint32_t isDiffAct( diff_f pDiff, const uint32_t* pInputActions ) const;
+    uint32_t isDiffAct( const diff_e pDiff, const uint32_t pInputAction ) const;
+    uint32_t isDiffAct( const diff_e pDiff, const uint32_t* pInputActions ) const;
 
     inline bool32_t isDownRaw( const uint32_t pInputGID ) const { return isDiffRaw(isDown, pInputGID); }
     inline uint32_t isDownRaw( const uint32_t* pInputGIDs ) const { return isDiffRaw(isDown, pInputGIDs); }
-    inline uint32_t isDownAct( const uint32_t pInputAction ) const { return isDiffAct(isDown, pInputAction); }
-    inline uint32_t isDownAct( const uint32_t* pInputActions ) const { return isDiffAct(isDown, pInputActions); }
+    inline uint32_t isDownAct( const uint32_t pInputAction ) const { return isDiffAct(diff_e::none, pInputAction); }
+    inline uint32_t isDownAct( const uint32_t* pInputActions ) const { return isDiffAct(diff_e::none, pInputActions); }
 
     inline bool32_t isPressedRaw( const uint32_t pInputGID ) const { return isDiffRaw(isPressed, pInputGID); }
     inline uint32_t isPressedRaw( const uint32_t* pInputGIDs ) const { return isDiffRaw(isPressed, pInputGIDs); }
-    inline uint32_t isPressedAct( const uint32_t pInputAction ) const { return isDiffAct(isPressed, pInputAction); }
-    inline uint32_t isPressedAct( const uint32_t* pInputActions ) const { return isDiffAct(isPressed, pInputActions); }
+    inline uint32_t isPressedAct( const uint32_t pInputAction ) const { return isDiffAct(diff_e::down, pInputAction); }
+    inline uint32_t isPressedAct( const uint32_t* pInputActions ) const { return isDiffAct(diff_e::down, pInputActions); }
 
     inline bool32_t isReleasedRaw( const uint32_t pInputGID ) const { return isDiffRaw(isReleased, pInputGID); }
     inline uint32_t isReleasedRaw( const uint32_t* pInputGIDs ) const { return isDiffRaw(isReleased, pInputGIDs); }
-    inline uint32_t isReleasedAct( const uint32_t pInputAction ) const { return isDiffAct(isReleased, pInputAction); }
-    inline uint32_t isReleasedAct( const uint32_t* pInputActions ) const { return isDiffAct(isReleased, pInputActions); }
+    inline uint32_t isReleasedAct( const uint32_t pInputAction ) const { return isDiffAct(diff_e::up, pInputAction); }
+    inline uint32_t isReleasedAct( const uint32_t* pInputActions ) const { return isDiffAct(diff_e::up, pInputActions); }
 };
 
+constexpr uint64_t input_t::FRAME_BYTES = offsetof( input_t, mBinding );
+
 }
 
 }
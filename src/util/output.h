@@ -5,8 +5,10 @@
 #include <SDL2/SDL_opengl.h>
 #include <SDL2/SDL_opengl_glext.h>
 
+#include <algorithm>
 #include <array>
 
+#include "arena_t.h"
 #include "gfx.h"
 #include "sfx.h"
 
@@ -35,19 +37,25 @@ struct output_t {
     uint32_t gfxBufferCBOs[GFXBuffers];   // color buffers
     uint32_t gfxBufferDBOs[GFXBuffers];   // depth buffers
     vec2u32_t gfxBufferRess[GFXBuffers];  // buffer resolutions
+    vec2u32_t gfxBufferCaps[GFXBuffers];  // buffer allocated resolutions
     box_t gfxBufferBoxs[GFXBuffers];      // buffer locations
+    gfx::format_t gfxBufferFormats[GFXBuffers]; // buffer formats
 
     // Audio Output //
     SDL_AudioSpec sfxConfig;              // audio config
     bit8_t* sfxBuffers[SFXBuffers];       // waveform buffers
     uint32_t sfxBufferFrames[SFXBuffers]; // frame ids per buffer
+
+    // Memory Output //
+    arena_t* memFrameArena;               // per-frame scratch memory
 };
 
 /// Namespace Functions ///
 
 template <uint32_t GFXBuffers, uint32_t SFXBuffers>
 void boot( output_t<GFXBuffers, SFXBuffers>& pOutput, const vec2u32_t& pGFXBufferRes,
-        const std::array<box_t, GFXBuffers>& pGFXBufferBoxs = std::array<box_t, GFXBuffers>() ) {
+        const std::array<box_t, GFXBuffers>& pGFXBufferBoxs = std::array<box_t, GFXBuffers>(),
+        const std::array<gfx::format_t, GFXBuffers>& pGFXBufferFormats = std::array<gfx::format_t, GFXBuffers>() ) {
     const static llce::box_t csFullBox( 0.0f, 0.0f, 1.0f, 1.0f );
 
     std::array<box_t, GFXBuffers> gfxBufferBoxs;
@@ -62,17 +70,25 @@ void boot( output_t<GFXBuffers, SFXBuffers>& pOutput, const vec2u32_t& pGFXBuffe
 
     // NOTE(JRC): The following code ensures that buffers have consistent aspect
     // ratios relative to their output spaces in screen space. This fact is crucial
-    // in making code work in 'ssn::gfx' related to fixing aspect ratios.
+    // in making code work in 'ssn::gfx' related to fixing aspect ratios. Buffer
+    // scales are applied uniformly, so they preserve these ratios as well.
     for( uint32_t bufferIdx = 0; bufferIdx < GFXBuffers; bufferIdx++ ) {
+        const float32_t cBufferScale = pGFXBufferFormats[bufferIdx].mScale;
         pOutput.gfxBufferBoxs[bufferIdx] = gfxBufferBoxs[bufferIdx];
+        pOutput.gfxBufferFormats[bufferIdx] = pGFXBufferFormats[bufferIdx];
         pOutput.gfxBufferRess[bufferIdx] = {
-            (gfxBufferBoxs[bufferIdx].mDims.x / csFullBox.mDims.x) * pGFXBufferRes.x,
-            (gfxBufferBoxs[bufferIdx].mDims.y / csFullBox.mDims.y) * pGFXBufferRes.y
+            cBufferScale * (gfxBufferBoxs[bufferIdx].mDims.x / csFullBox.mDims.x) * pGFXBufferRes.x,
+            cBufferScale * (gfxBufferBoxs[bufferIdx].mDims.y / csFullBox.mDims.y) * pGFXBufferRes.y
         };
+        LLCE_CHECK_ERROR( pOutput.gfxBufferRess[bufferIdx].x <= LLCE_MAX_RESOLUTION &&
+            pOutput.gfxBufferRess[bufferIdx].y <= LLCE_MAX_RESOLUTION,
+            "Invalid scale specified for frame buffer " << bufferIdx << "; " <<
+            "scaled resolutions can't exceed " << LLCE_MAX_RESOLUTION << " pixels." );
+        pOutput.gfxBufferCaps[bufferIdx] = pOutput.gfxBufferRess[bufferIdx];
     }
 
     for( uint32_t bufferIdx = 0; bufferIdx < GFXBuffers; bufferIdx++ ) {
-        llce::gfx::fbo_t gfxBufferFBO( pOutput.gfxBufferRess[bufferIdx] );
+        llce::gfx::fbo_t gfxBufferFBO( pOutput.gfxBufferRess[bufferIdx], pOutput.gfxBufferFormats[bufferIdx] );
         LLCE_ASSERT_ERROR( gfxBufferFBO.valid(),
             "Failed to initialize frame buffer " << bufferIdx << "; " <<
             "failed with frame buffer error '" << glCheckFramebufferStatus(GL_FRAMEBUFFER) << "'." );
@@ -81,6 +97,24 @@ void boot( output_t<GFXBuffers, SFXBuffers>& pOutput, const vec2u32_t& pGFXBuffe
         pOutput.gfxBufferCBOs[bufferIdx] = gfxBufferFBO.mColorID;
         pOutput.gfxBufferDBOs[bufferIdx] = gfxBufferFBO.mDepthID;
     }
+
+    llce::gfx::boot();
+}
+
+
+// NOTE(JRC): Scaling only changes the region of each frame buffer that's rendered
+// (i.e. its bottom-left 'gfxBufferRess' pixels) and never reallocates it, so the
+// given scale is clamped to the resolutions allocated at boot time.
+template <uint32_t GFXBuffers, uint32_t SFXBuffers>
+void scale( output_t<GFXBuffers, SFXBuffers>& pOutput, const float32_t pScale ) {
+    const float32_t cScale = std::min( std::max(pScale, 0.0f), 1.0f );
+    for( uint32_t bufferIdx = 0; bufferIdx < GFXBuffers; bufferIdx++ ) {
+        const vec2u32_t& cBufferCap = pOutput.gfxBufferCaps[bufferIdx];
+        pOutput.gfxBufferRess[bufferIdx] = {
+            std::max( static_cast<uint32_t>(cScale * cBufferCap.x + 0.5f), 1u ),
+            std::max( static_cast<uint32_t>(cScale * cBufferCap.y + 0.5f), 1u )
+        };
+    }
 }
 
 }
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "raster_t.h"
+
+namespace llce {
+
+/// Helper Functions ///
+
+// NOTE(JRC): Returns the index of the first pixel whose center lies at or beyond
+// the given fixed-point coordinate, which makes every coverage range half-open.
+inline int32_t center( const int32_t pFixed ) {
+    return ( pFixed + (raster_t::SUBPIXEL_ONE / 2 - 1) ) >> raster_t::SUBPIXEL_BITS;
+}
+
+
+inline int64_t orient( const vec2i32_t& pA, const vec2i32_t& pB, const vec2i32_t& pC ) {
+    return static_cast<int64_t>( pB.x - pA.x ) * ( pC.y - pA.y ) -
+        static_cast<int64_t>( pB.y - pA.y ) * ( pC.x - pA.x );
+}
+
+// NOTE(JRC): A pixel center that lies exactly on an edge is only covered if that
+// edge is a left or bottom edge of its (counterclockwise) triangle, which ensures
+// that triangles that share an edge never cover the same pixel twice and that
+// rectangles drawn as triangles cover the same pixels as those drawn via 'fill'.
+inline int64_t bias( const vec2i32_t& pA, const vec2i32_t& pB ) {
+    const bool32_t cIsLeft = pB.y < pA.y;
+    const bool32_t cIsBottom = pB.y == pA.y && pB.x > pA.x;
+    return ( cIsLeft || cIsBottom ) ? 0 : -1;
+}
+
+/// Class Functions ///
+
+raster_t::raster_t() :
+        mPixels( nullptr ), mRes( 0, 0 ), mClipMin( 0, 0 ), mClipMax( 0, 0 ) {
+}
+
+
+raster_t::raster_t( color4u8_t* pPixels, const vec2u32_t& pRes ) :
+        mPixels( pPixels ), mRes( pRes ), mClipMin( 0, 0 ), mClipMax( pRes.x, pRes.y ) {
+}
+
+
+void raster_t::clip( const vec2i32_t& pPos, const vec2i32_t& pDims ) {
+    mClipMin = { std::max(pPos.x, 0), std::max(pPos.y, 0) };
+    mClipMax = {
+        std::min(pPos.x + pDims.x, static_cast<int32_t>(mRes.x)),
+        std::min(pPos.y + pDims.y, static_cast<int32_t>(mRes.y)) };
+}
+
+
+void raster_t::clear( const color4u8_t& pColor ) {
+    for( int32_t pixelY = mClipMin.y; pixelY < mClipMax.y && mClipMin.x < mClipMax.x; pixelY++ ) {
+        std::fill_n( &mPixels[pixelY * mRes.x + mClipMin.x], mClipMax.x - mClipMin.x, pColor );
+    }
+}
+
+
+void raster_t::fill( const vec2i32_t& pMin, const vec2i32_t& pMax, const color4u8_t& pColor ) {
+    const int32_t cMinX = std::max( mClipMin.x, center(std::min(pMin.x, pMax.x)) );
+    const int32_t cMinY = std::max( mClipMin.y, center(std::min(pMin.y, pMax.y)) );
+    const int32_t cMaxX = std::min( mClipMax.x, center(std::max(pMin.x, pMax.x)) );
+    const int32_t cMaxY = std::min( mClipMax.y, center(std::max(pMin.y, pMax.y)) );
+
+    for( int32_t pixelY = cMinY; pixelY < cMaxY && cMinX < cMaxX; pixelY++ ) {
+        span( &mPixels[pixelY * mRes.x + cMinX], cMaxX - cMinX, pColor );
+    }
+}
+
+
+void raster_t::triangle( const vec2i32_t (&pVertices)[3], const color4u8_t& pColor ) {
+    vec2i32_t v0 = pVertices[0], v1 = pVertices[1], v2 = pVertices[2];
+    const int64_t cArea = orient( v0, v1, v2 );
+    if( cArea == 0 ) {
+        return;
+    } else if( cArea < 0 ) {
+        std::swap( v1, v2 );
+    }
+
+    const int32_t cMinX = std::max( mClipMin.x, center(std::min({v0.x, v1.x, v2.x})) );
+    const int32_t cMinY = std::max( mClipMin.y, center(std::min({v0.y, v1.y, v2.y})) );
+    const int32_t cMaxX = std::min( mClipMax.x, center(std::max({v0.x, v1.x, v2.x})) );
+    const int32_t cMaxY = std::min( mClipMax.y, center(std::max({v0.y, v1.y, v2.y})) );
+    if( cMinX >= cMaxX || cMinY >= cMaxY ) {
+        return;
+    }
+
+    // NOTE(JRC): The edge functions are evaluated once at the first pixel center
+    // and then stepped incrementally, which only requires additions per pixel.
+    const vec2i32_t cStart(
+        ( cMinX << SUBPIXEL_BITS ) + SUBPIXEL_ONE / 2,
+        ( cMinY << SUBPIXEL_BITS ) + SUBPIXEL_ONE / 2 );
+    const vec2i32_t* cEdges[3][2] = { {&v1, &v2}, {&v2, &v0}, {&v0, &v1} };
+
+    int64_t rowWeights[3], stepXs[3], stepYs[3];
+    for( uint32_t edgeIdx = 0; edgeIdx < 3; edgeIdx++ ) {
+        const vec2i32_t& cA = *cEdges[edgeIdx][0];
+        const vec2i32_t& cB = *cEdges[edgeIdx][1];
+        rowWeights[edgeIdx] = orient( cA, cB, cStart ) + bias( cA, cB );
+        stepXs[edgeIdx] = -static_cast<int64_t>( cB.y - cA.y ) * SUBPIXEL_ONE;
+        stepYs[edgeIdx] = static_cast<int64_t>( cB.x - cA.x ) * SUBPIXEL_ONE;
+    }
+
+    for( int32_t pixelY = cMinY; pixelY < cMaxY; pixelY++ ) {
+        int64_t weights[3] = { rowWeights[0], rowWeights[1], rowWeights[2] };
+        int32_t spanStart = cMaxX, spanEnd = cMaxX;
+        for( int32_t pixelX = cMinX; pixelX < cMaxX; pixelX++ ) {
+            const bool32_t cIsInside = ( weights[0] | weights[1] | weights[2] ) >= 0;
+            if( cIsInside && spanStart == cMaxX ) {
+                spanStart = pixelX;
+            } else if( !cIsInside && spanStart != cMaxX ) {
+                spanEnd = pixelX;
+                break;
+            }
+            for( uint32_t edgeIdx = 0; edgeIdx < 3; edgeIdx++ ) {
+                weights[edgeIdx] += stepXs[edgeIdx];
+            }
+        }
+
+        if( spanStart < spanEnd ) {
+            span( &mPixels[pixelY * mRes.x + spanStart], spanEnd - spanStart, pColor );
+        }
+        for( uint32_t edgeIdx = 0; edgeIdx < 3; edgeIdx++ ) {
+            rowWeights[edgeIdx] += stepYs[edgeIdx];
+        }
+    }
+}
+
+
+// NOTE(JRC): Blits replace the destination pixels (i.e. no blending) and sample
+// the source's bottom-left region of the given dimensions at the nearest pixel
+// center, which matches 'glBlitFramebuffer' with a 'GL_NEAREST' filter.
+void raster_t::blit( const raster_t& pSource, const vec2i32_t& pSourceDims,
+        const vec2i32_t& pPos, const vec2i32_t& pDims ) {
+    const int32_t cMinX = std::max( mClipMin.x, pPos.x ), cMaxX = std::min( mClipMax.x, pPos.x + pDims.x );
+    const int32_t cMinY = std::max( mClipMin.y, pPos.y ), cMaxY = std::min( mClipMax.y, pPos.y + pDims.y );
+    if( pSource.mPixels == mPixels || cMinX >= cMaxX || cMinY >= cMaxY ) {
+        return;
+    }
+
+    uint32_t sourceXs[LLCE_MAX_RESOLUTION];
+    for( int32_t pixelX = cMinX; pixelX < cMaxX; pixelX++ ) {
+        sourceXs[pixelX - cMinX] = static_cast<uint32_t>(
+            (2 * static_cast<int64_t>(pixelX - pPos.x) + 1) * pSourceDims.x / (2 * pDims.x) );
+    }
+
+    for( int32_t pixelY = cMinY; pixelY < cMaxY; pixelY++ ) {
+        const uint32_t cSourceY = static_cast<uint32_t>(
+            (2 * static_cast<int64_t>(pixelY - pPos.y) + 1) * pSourceDims.y / (2 * pDims.y) );
+        const color4u8_t* cSourceRow = &pSource.mPixels[cSourceY * pSource.mRes.x];
+        color4u8_t* destRow = &mPixels[pixelY * mRes.x];
+        for( int32_t pixelX = cMinX; pixelX < cMaxX; pixelX++ ) {
+            destRow[pixelX] = cSourceRow[sourceXs[pixelX - cMinX]];
+        }
+    }
+}
+
+
+bool32_t raster_t::valid() const {
+    return mPixels != nullptr && mRes.x > 0 && mRes.y > 0;
+}
+
+
+// NOTE(JRC): Each channel is blended as '(s * a + d * (255 - a)) / 255' with
+// the division computed exactly (with rounding) as '(t + (t >> 8)) >> 8', where
+// 't = s * a + d * (255 - a) + 128'; all intermediate values fit in 16 bits, so
+// SSE2 blends two pixels per 128-bit register half with identical results.
+void raster_t::span( color4u8_t* pPixels, const uint32_t pCount, const color4u8_t& pColor ) const {
+    const uint32_t cAlpha = pColor.w;
+    if( cAlpha == 0x00 ) {
+        return;
+    } else if( cAlpha == 0xff ) {
+        std::fill_n( pPixels, pCount, pColor );
+        return;
+    }
+
+    const uint32_t cInverse = 0xff - cAlpha;
+    const uint32_t cSource[4] = {
+        pColor.x * cAlpha + 0x80, pColor.y * cAlpha + 0x80,
+        pColor.z * cAlpha + 0x80, pColor.w * cAlpha + 0x80 };
+
+    uint32_t pixelIdx = 0;
+#if defined(__SSE2__)
+    const __m128i cZeroes = _mm_setzero_si128();
+    const __m128i cInverses = _mm_set1_epi16( static_cast<int16_t>(cInverse) );
+    const __m128i cSources = _mm_set_epi16(
+        cSource[3], cSource[2], cSource[1], cSource[0],
+        cSource[3], cSource[2], cSource[1], cSource[0] );
+    const auto cBlend = [&] ( __m128i pDest ) {
+        const __m128i cTotal = _mm_add_epi16( _mm_mullo_epi16(pDest, cInverses), cSources );
+        return _mm_srli_epi16( _mm_add_epi16(cTotal, _mm_srli_epi16(cTotal, 8)), 8 );
+    };
+
+    for( ; pixelIdx + 4 <= pCount; pixelIdx += 4 ) {
+        const __m128i cDests = _mm_loadu_si128( (const __m128i*)&pPixels[pixelIdx] );
+        const __m128i cLows = cBlend( _mm_unpacklo_epi8(cDests, cZeroes) );
+        const __m128i cHighs = cBlend( _mm_unpackhi_epi8(cDests, cZeroes) );
+        _mm_storeu_si128( (__m128i*)&pPixels[pixelIdx], _mm_packus_epi16(cLows, cHighs) );
+    }
+#endif
+    for( ; pixelIdx < pCount; pixelIdx++ ) {
+        uint8_t* pixel = (uint8_t*)&pPixels[pixelIdx];
+        for( uint32_t channelIdx = 0; channelIdx < 4; channelIdx++ ) {
+            const uint32_t cTotal = pixel[channelIdx] * cInverse + cSource[channelIdx];
+            pixel[channelIdx] = static_cast<uint8_t>( (cTotal + (cTotal >> 8)) >> 8 );
+        }
+    }
+}
+
+}
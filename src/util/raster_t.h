@@ -0,0 +1,57 @@
+#ifndef LLCE_RASTER_T_H
+#define LLCE_RASTER_T_H
+
+#include "consts.h"
+
+// NOTE(JRC): A raster is a CPU-side color buffer (bottom row first, like OpenGL)
+// that can be drawn to without a graphics device. All primitive coordinates are
+// given in window space as 28.4 fixed-point values and all coverage decisions are
+// made with integer arithmetic at pixel centers (with a bottom-left fill rule), so
+// the output is bit-exact across machines and compilers. Blending emulates the
+// 'GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA' configuration used by the harness.
+// Every operation (including 'clear') only touches pixels within the clip box,
+// so disjoint regions of a raster can be drawn concurrently via per-thread copies.
+
+namespace llce {
+
+class raster_t {
+    public:
+
+    /// Class Attributes ///
+
+    const static int32_t SUBPIXEL_BITS = 4;
+    const static int32_t SUBPIXEL_ONE = 1 << SUBPIXEL_BITS;
+
+    /// Constructors ///
+
+    raster_t();
+    raster_t( color4u8_t* pPixels, const vec2u32_t& pRes );
+
+    /// Class Functions ///
+
+    void clip( const vec2i32_t& pPos, const vec2i32_t& pDims );
+    void clear( const color4u8_t& pColor );
+
+    void fill( const vec2i32_t& pMin, const vec2i32_t& pMax, const color4u8_t& pColor );
+    void triangle( const vec2i32_t (&pVertices)[3], const color4u8_t& pColor );
+    void blit( const raster_t& pSource, const vec2i32_t& pSourceDims,
+        const vec2i32_t& pPos, const vec2i32_t& pDims );
+
+    bool32_t valid() const;
+
+    /// Class Fields ///
+
+    color4u8_t* mPixels;
+    vec2u32_t mRes;
+    vec2i32_t mClipMin, mClipMax;
+
+    private:
+
+    /// Class Functions ///
+
+    void span( color4u8_t* pPixels, const uint32_t pCount, const color4u8_t& pColor ) const;
+};
+
+}
+
+#endif
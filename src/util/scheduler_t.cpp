@@ -0,0 +1,167 @@
+#include <algorithm>
+
+#include "scheduler_t.h"
+
+namespace llce {
+
+/// Helper Functions ///
+
+inline uint64_t packRange( const uint32_t pBegin, const uint32_t pEnd ) {
+    return ( static_cast<uint64_t>(pEnd) << 32 ) | static_cast<uint64_t>( pBegin );
+}
+
+
+inline uint32_t rangeBegin( const uint64_t pRange ) {
+    return static_cast<uint32_t>( pRange & 0xFFFFFFFF );
+}
+
+
+inline uint32_t rangeEnd( const uint64_t pRange ) {
+    return static_cast<uint32_t>( pRange >> 32 );
+}
+
+/// Class Functions ///
+
+scheduler_t::scheduler_t( const uint32_t pWorkerCount ) :
+        mWorkerCount( 1 ), mTask( nullptr ), mTaskData( nullptr ),
+        mTasksPending( 0 ), mWorkersActive( 0 ),
+        mWakeGeneration( 0 ), mIsStopping( false ) {
+    const uint32_t cWorkerCount = ( pWorkerCount != 0 ) ?
+        pWorkerCount : std::thread::hardware_concurrency();
+    mWorkerCount = std::min( std::max(cWorkerCount, 1u), MAX_WORKERS );
+
+    for( uint32_t workerIdx = 0; workerIdx < mWorkerCount; workerIdx++ ) {
+        mRanges[workerIdx].mBounds.store( packRange(0, 0), std::memory_order_relaxed );
+    }
+
+    // NOTE(JRC): Worker 0 is always the thread that calls 'run', so only the
+    // remaining workers need dedicated threads.
+    for( uint32_t workerIdx = 1; workerIdx < mWorkerCount; workerIdx++ ) {
+        mThreads[workerIdx] = std::thread( &scheduler_t::work, this, workerIdx );
+    }
+}
+
+
+scheduler_t::~scheduler_t() {
+    {
+        std::lock_guard<std::mutex> wakeLock( mWakeMutex );
+        mIsStopping = true;
+    }
+    mWakeCondition.notify_all();
+
+    for( uint32_t workerIdx = 1; workerIdx < mWorkerCount; workerIdx++ ) {
+        mThreads[workerIdx].join();
+    }
+}
+
+
+void scheduler_t::run( task_f pTask, void* pTaskData, const uint32_t pTaskCount ) {
+    if( pTaskCount == 0 ) {
+        return;
+    }
+
+    mTask = pTask;
+    mTaskData = pTaskData;
+    for( uint32_t workerIdx = 0; workerIdx < mWorkerCount; workerIdx++ ) {
+        const uint32_t cRangeBegin = static_cast<uint32_t>( (uint64_t)pTaskCount * workerIdx / mWorkerCount );
+        const uint32_t cRangeEnd = static_cast<uint32_t>( (uint64_t)pTaskCount * (workerIdx + 1) / mWorkerCount );
+        mRanges[workerIdx].mBounds.store( packRange(cRangeBegin, cRangeEnd), std::memory_order_relaxed );
+    }
+    mTasksPending.store( pTaskCount, std::memory_order_relaxed );
+    mWorkersActive.store( mWorkerCount - 1, std::memory_order_relaxed );
+
+    if( mWorkerCount > 1 ) {
+        {
+            std::lock_guard<std::mutex> wakeLock( mWakeMutex );
+            mWakeGeneration++;
+        }
+        mWakeCondition.notify_all();
+    }
+
+    execute( 0 );
+
+    // NOTE(JRC): The caller also waits for all workers to leave the batch (and
+    // not just for all tasks to finish) so that no worker can observe the ranges
+    // of the next batch while it's still stealing from those of this one.
+    while( mTasksPending.load(std::memory_order_acquire) != 0 ||
+            mWorkersActive.load(std::memory_order_acquire) != 0 ) {
+        std::this_thread::yield();
+    }
+}
+
+
+uint32_t scheduler_t::workers() const {
+    return mWorkerCount;
+}
+
+
+void scheduler_t::work( const uint32_t pWorkerIdx ) {
+    uint64_t wakeGeneration = 0;
+    while( true ) {
+        {
+            std::unique_lock<std::mutex> wakeLock( mWakeMutex );
+            mWakeCondition.wait( wakeLock, [this, &wakeGeneration] () {
+                return mIsStopping || mWakeGeneration != wakeGeneration; } );
+            if( mIsStopping ) {
+                return;
+            }
+            wakeGeneration = mWakeGeneration;
+        }
+
+        execute( pWorkerIdx );
+        mWorkersActive.fetch_sub( 1, std::memory_order_release );
+    }
+}
+
+
+void scheduler_t::execute( const uint32_t pWorkerIdx ) {
+    uint32_t taskIdx = 0;
+    while( true ) {
+        if( pop(pWorkerIdx, taskIdx) ) {
+            mTask( mTaskData, taskIdx );
+            mTasksPending.fetch_sub( 1, std::memory_order_acq_rel );
+        } else if( !steal(pWorkerIdx) ) {
+            break;
+        }
+    }
+}
+
+
+bool32_t scheduler_t::pop( const uint32_t pWorkerIdx, uint32_t& pTaskIdx ) {
+    std::atomic<uint64_t>& bounds = mRanges[pWorkerIdx].mBounds;
+
+    uint64_t range = bounds.load( std::memory_order_acquire );
+    while( rangeBegin(range) < rangeEnd(range) ) {
+        if( bounds.compare_exchange_weak(range, packRange(rangeBegin(range) + 1, rangeEnd(range)),
+                std::memory_order_acq_rel, std::memory_order_acquire) ) {
+            pTaskIdx = rangeBegin( range );
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+// NOTE(JRC): Thieves only ever install stolen tasks into their own (empty) ranges,
+// which other thieves skip over until the new tasks have been published.
+bool32_t scheduler_t::steal( const uint32_t pWorkerIdx ) {
+    for( uint32_t victimOff = 1; victimOff < mWorkerCount; victimOff++ ) {
+        std::atomic<uint64_t>& bounds = mRanges[(pWorkerIdx + victimOff) % mWorkerCount].mBounds;
+
+        uint64_t range = bounds.load( std::memory_order_acquire );
+        while( rangeBegin(range) < rangeEnd(range) ) {
+            const uint32_t cStealBegin = rangeBegin( range ) + ( rangeEnd(range) - rangeBegin(range) ) / 2;
+            if( bounds.compare_exchange_weak(range, packRange(rangeBegin(range), cStealBegin),
+                    std::memory_order_acq_rel, std::memory_order_acquire) ) {
+                mRanges[pWorkerIdx].mBounds.store(
+                    packRange(cStealBegin, rangeEnd(range)), std::memory_order_release );
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+}
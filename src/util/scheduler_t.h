@@ -0,0 +1,77 @@
+#ifndef LLCE_SCHEDULER_T_H
+#define LLCE_SCHEDULER_T_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "consts.h"
+
+// NOTE(JRC): The scheduler runs batches of indexed tasks across a fixed pool of
+// worker threads (including the calling thread) and returns once all of them are
+// complete. Each batch is split evenly into one index range per worker; workers
+// consume their own ranges from the front and, once theirs are exhausted, steal
+// the back half of another worker's range. Ranges are packed into single atomic
+// words, so both consuming and stealing are lock-free, and the only locking is
+// used to put idle workers to sleep between batches.
+
+namespace llce {
+
+class scheduler_t {
+    public:
+
+    /// Class Attributes ///
+
+    const static uint32_t MAX_WORKERS = 32;
+    const static uint64_t CACHE_LINE_LENGTH = 64;
+
+    typedef void (*task_f)( void* pTaskData, const uint32_t pTaskIdx );
+
+    /// Constructors ///
+
+    scheduler_t( const uint32_t pWorkerCount = 0 );
+    ~scheduler_t();
+
+    /// Class Functions ///
+
+    void run( task_f pTask, void* pTaskData, const uint32_t pTaskCount );
+
+    uint32_t workers() const;
+
+    private:
+
+    /// Class Setup ///
+
+    struct alignas(CACHE_LINE_LENGTH) range_t {
+        std::atomic<uint64_t> mBounds;
+    };
+
+    /// Class Functions ///
+
+    void work( const uint32_t pWorkerIdx );
+    void execute( const uint32_t pWorkerIdx );
+
+    bool32_t pop( const uint32_t pWorkerIdx, uint32_t& pTaskIdx );
+    bool32_t steal( const uint32_t pWorkerIdx );
+
+    /// Class Fields ///
+
+    range_t mRanges[MAX_WORKERS];
+    std::thread mThreads[MAX_WORKERS];
+    uint32_t mWorkerCount;
+
+    task_f mTask;
+    void* mTaskData;
+    std::atomic<uint32_t> mTasksPending;
+    std::atomic<uint32_t> mWorkersActive;
+
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    uint64_t mWakeGeneration;
+    bool32_t mIsStopping;
+};
+
+}
+
+#endif